@@ -1,7 +1,12 @@
 #include "Crash/Analysis.h"
 
+#include "Crash/Disassembly.h"
 #include "Crash/Introspection/Introspection.h"
+#include "Crash/Modules/CodePatches.h"
+#include "Crash/Modules/UnloadedModules.h"
+#include "Crash/StackWords.h"
 
+#include <Settings.h>
 #include <Windows.h>
 #include <unordered_set>
 
@@ -37,116 +42,199 @@ namespace Crash
 		return std::make_pair(regs, values);
 	}
 
-	// Get stack memory span from CONTEXT (using TIB of current thread)
-	// NOTE: Only valid for crash logs where CONTEXT is from current thread!
-	std::optional<std::span<const std::size_t>> get_stack_info(const ::CONTEXT& a_context)
+	namespace
 	{
-		const auto tib = reinterpret_cast<const ::NT_TIB*>(::NtCurrentTeb());
-		const auto base = tib ? static_cast<const std::size_t*>(tib->StackBase) : nullptr;
-		if (!base) {
-			return std::nullopt;
+		[[nodiscard]] bool is_readable(const ::MEMORY_BASIC_INFORMATION& a_mbi) noexcept
+		{
+			if (a_mbi.State != MEM_COMMIT || (a_mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS)) != 0) {
+				return false;
+			}
+			return (a_mbi.Protect & (PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY |
+										PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY)) != 0;
+		}
+
+		// Copy a_size bytes a page at a time, stopping at the first page that faults.
+		// Kept free of objects that require unwinding so it can use __try/__except (MSVC C2712).
+		std::size_t safe_copy_pages(const std::byte* a_src, std::byte* a_dst, std::size_t a_size) noexcept
+		{
+			constexpr std::size_t PAGE_SIZE = 0x1000;
+			std::size_t copied = 0;
+			__try {
+				while (copied < a_size) {
+					const auto pageLeft = PAGE_SIZE - (reinterpret_cast<std::uintptr_t>(a_src + copied) & (PAGE_SIZE - 1));
+					const auto chunk = std::min(a_size - copied, pageLeft);
+					std::memcpy(a_dst + copied, a_src + copied, chunk);
+					copied += chunk;
+				}
+			} __except (EXCEPTION_EXECUTE_HANDLER) {
+			}
+			return copied;
 		}
-		const auto rsp = reinterpret_cast<const std::size_t*>(a_context.Rsp);
-		return std::span{ rsp, base };
 	}
 
-	// Get stack memory span from CONTEXT with explicit max size (safe for thread dumps)
-	// Uses RSP from CONTEXT and scans up to max_bytes (default 64KB)
-	std::span<const std::size_t> get_stack_info_safe(const ::CONTEXT& a_context, std::size_t max_bytes)
+	StackSnapshot StackSnapshot::capture(const ::CONTEXT& a_context, std::size_t a_max_bytes)
 	{
-		const auto rsp = reinterpret_cast<const std::size_t*>(a_context.Rsp);
-		const std::size_t max_qwords = max_bytes / sizeof(std::size_t);
-		return std::span{ rsp, max_qwords };
+		StackSnapshot snapshot;
+		const auto start = reinterpret_cast<const std::byte*>(a_context.Rsp & ~std::uintptr_t{ 7 });
+		snapshot._rsp = reinterpret_cast<std::uintptr_t>(start);
+
+		::MEMORY_BASIC_INFORMATION mbi{};
+		if (!start || !::VirtualQuery(start, &mbi, sizeof(mbi)) || !is_readable(mbi)) {
+			return snapshot;
+		}
+
+		// Extend over committed, readable regions of the same reservation (the thread's stack)
+		const auto reservation = mbi.AllocationBase;
+		const auto limit = start + std::min<std::size_t>(a_max_bytes, std::numeric_limits<std::uintptr_t>::max() - snapshot._rsp);
+		auto end = start;
+		while (end < limit && ::VirtualQuery(end, &mbi, sizeof(mbi)) && mbi.AllocationBase == reservation && is_readable(mbi)) {
+			end = std::min(limit, static_cast<const std::byte*>(mbi.BaseAddress) + mbi.RegionSize);
+		}
+
+		snapshot._words.resize(static_cast<std::size_t>(end - start) / sizeof(std::size_t));
+		const auto copied = safe_copy_pages(start, reinterpret_cast<std::byte*>(snapshot._words.data()), snapshot._words.size() * sizeof(std::size_t));
+		snapshot._words.resize(copied / sizeof(std::size_t));
+		return snapshot;
+	}
+
+	void apply_introspection_limits(Introspection::AnalysisContext& a_analysis)
+	{
+		const auto& debug = Settings::GetSingleton()->GetDebug();
+		Introspection::Limits limits;
+		if (debug.introspectionDeadlineSeconds > 0) {
+			limits.deadline = std::chrono::steady_clock::now() + std::chrono::seconds(debug.introspectionDeadlineSeconds);
+		}
+		limits.objectBudget = std::chrono::milliseconds(std::max(debug.introspectionObjectBudgetMs, 0));
+		limits.maxDepth = std::max(debug.introspectionMaxDepth, 0);
+		a_analysis.set_limits(limits);
 	}
 
 	// Analyze register values with introspection
-	std::pair<RegisterInfo, std::vector<std::string>> analyze_registers(
+	std::pair<RegisterInfo, std::vector<Introspection::RecordHandle>> analyze_registers(
+		Introspection::AnalysisContext& a_analysis,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules)
 	{
 		const auto [regs, regValues] = get_register_info(a_context);
-		auto analysis = Introspection::analyze_data(regValues, a_modules, [&](size_t i) {
+		auto analysis = Introspection::analyze_data(a_analysis, regValues, a_modules, [&](size_t i) {
 			return std::string(regs[i].first);
 		});
-		Introspection::backfill_void_pointers(analysis, regValues);
+		Introspection::backfill_void_pointers(a_analysis, analysis, regValues);
 		return std::make_pair(regs, analysis);
 	}
 
-	// Analyze stack memory blocks with introspection
-	std::vector<std::vector<std::string>> analyze_stack_blocks(
-		std::span<const std::size_t> stack,
-		std::span<const module_pointer> a_modules)
+	namespace
 	{
-		constexpr std::size_t BLOCK_SIZE = 1000;
-		const std::size_t scanSize = stack.size();
+		constexpr std::size_t STACK_BLOCK_SIZE = 1000;
 
-		std::vector<std::vector<std::string>> all_analysis_results;
-		std::vector<std::span<const std::size_t>> all_address_spans;
+		// Introspect the stack in STACK_BLOCK_SIZE blocks, without backfilling
+		[[nodiscard]] std::vector<std::vector<Introspection::RecordHandle>> analyze_stack_blocks_unfilled(
+			Introspection::AnalysisContext& a_analysis,
+			std::span<const std::size_t> stack,
+			std::span<const module_pointer> a_modules)
+		{
+			const std::size_t scanSize = stack.size();
+
+			std::vector<std::vector<Introspection::RecordHandle>> all_analysis_results;
+			for (std::size_t off = 0; off < scanSize; off += STACK_BLOCK_SIZE) {
+				auto block_span = stack.subspan(off, std::min<std::size_t>(scanSize - off, STACK_BLOCK_SIZE));
+				all_analysis_results.push_back(Introspection::analyze_data(
+					a_analysis, block_span, a_modules, [&](size_t i) {
+						return fmt::format("RSP+{:X}", (off + i) * sizeof(std::size_t));
+					}));
+			}
+			return all_analysis_results;
+		}
 
-		for (std::size_t off = 0; off < scanSize; off += BLOCK_SIZE) {
-			auto block_span = stack.subspan(off, std::min<std::size_t>(scanSize - off, BLOCK_SIZE));
-			auto analysis = Introspection::analyze_data(
-				block_span, a_modules, [&](size_t i) {
-					return fmt::format("RSP+{:X}", (off + i) * sizeof(std::size_t));
-				});
-			all_analysis_results.push_back(std::move(analysis));
-			all_address_spans.push_back(block_span);
+		void backfill_stack_blocks(
+			Introspection::AnalysisContext& a_analysis,
+			std::vector<std::vector<Introspection::RecordHandle>>& a_blocks,
+			std::span<const std::size_t> stack)
+		{
+			for (std::size_t block_idx = 0; block_idx < a_blocks.size(); ++block_idx) {
+				const auto off = block_idx * STACK_BLOCK_SIZE;
+				Introspection::backfill_void_pointers(a_analysis, a_blocks[block_idx], stack.subspan(off, a_blocks[block_idx].size()));
+			}
 		}
+	}
+
+	// Analyze stack memory blocks with introspection
+	std::vector<std::vector<Introspection::RecordHandle>> analyze_stack_blocks(
+		Introspection::AnalysisContext& a_analysis,
+		std::span<const std::size_t> stack,
+		std::span<const module_pointer> a_modules)
+	{
+		auto all_analysis_results = analyze_stack_blocks_unfilled(a_analysis, stack, a_modules);
 
 		// Backfill all results at once
-		for (std::size_t block_idx = 0; block_idx < all_analysis_results.size(); ++block_idx) {
-			Introspection::backfill_void_pointers(all_analysis_results[block_idx], all_address_spans[block_idx]);
-		}
+		backfill_stack_blocks(a_analysis, all_analysis_results, stack);
 
 		return all_analysis_results;
 	}
 
+	ThreadAnalysis analyze_thread(
+		Introspection::AnalysisContext& a_analysis,
+		const ::CONTEXT& a_context,
+		std::span<const std::size_t> a_stack,
+		std::span<const module_pointer> a_modules)
+	{
+		ThreadAnalysis result;
+		const auto [regs, regValues] = get_register_info(a_context);
+		result.registers = regs;
+		result.registerAnalysis = Introspection::analyze_data(a_analysis, regValues, a_modules, [&](size_t i) {
+			return std::string(regs[i].first);
+		});
+		result.stackBlocks = analyze_stack_blocks_unfilled(a_analysis, a_stack, a_modules);
+
+		// Backfill only once everything has been seen, so registers can name objects first met on the stack
+		Introspection::backfill_void_pointers(a_analysis, result.registerAnalysis, regValues);
+		backfill_stack_blocks(a_analysis, result.stackBlocks, a_stack);
+		return result;
+	}
+
 	// Print registers with pre-analyzed results
 	void print_registers(
 		spdlog::logger& a_log,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules,
-		const std::vector<std::string>& pre_analyzed)
+		const std::vector<Introspection::RecordHandle>& pre_analyzed)
 	{
 		a_log.critical("REGISTERS:"sv);
 
 		const auto [regs, regValues] = get_register_info(a_context);
 		for (std::size_t i = 0; i < regs.size(); ++i) {
 			const auto& [name, reg] = regs[i];
-			a_log.critical("\t{:<3} 0x{:<16X} {}"sv, name, reg, pre_analyzed[i]);
+			a_log.critical("\t{:<3} 0x{:<16X} {}"sv, name, reg, pre_analyzed[i]->render());
 		}
 	}
 
 	// Print registers with on-the-fly analysis
 	void print_registers(
 		spdlog::logger& a_log,
+		Introspection::AnalysisContext& a_analysis,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules)
 	{
-		const auto [regs, analysis] = analyze_registers(a_context, a_modules);
+		const auto [regs, analysis] = analyze_registers(a_analysis, a_context, a_modules);
 		print_registers(a_log, a_context, a_modules, analysis);
 	}
 
 	// Print stack with pre-analyzed results
 	void print_stack(
 		spdlog::logger& a_log,
-		const ::CONTEXT& a_context,
+		std::span<const std::size_t> a_stack,
 		std::span<const module_pointer> a_modules,
-		const std::vector<std::vector<std::string>>& pre_analyzed_blocks)
+		const std::vector<std::vector<Introspection::RecordHandle>>& pre_analyzed_blocks)
 	{
-		const auto stack_opt = get_stack_info(a_context);
-		if (!stack_opt) {
-			a_log.critical("STACK:"sv);
-			a_log.critical("\tFAILED TO READ TIB"sv);
+		a_log.critical("STACK:"sv);
+		if (a_stack.empty()) {
+			a_log.critical("\tFAILED TO READ STACK"sv);
 			return;
 		}
-		const auto& stack = *stack_opt;
-
-		a_log.critical("STACK:"sv);
 
 		const auto format = [&]() {
 			return "\t[RSP+{:<"s +
-			       fmt::to_string(fmt::format("{:X}"sv, (stack.size() - 1) * sizeof(std::size_t)).length()) +
+			       fmt::to_string(fmt::format("{:X}"sv, (a_stack.size() - 1) * sizeof(std::size_t)).length()) +
 			       "X}] 0x{:<16X} {}"s;
 		}();
 
@@ -154,9 +242,9 @@ namespace Crash
 		std::size_t global_idx = 0;
 		for (std::size_t block_idx = 0; block_idx < pre_analyzed_blocks.size(); ++block_idx) {
 			const auto& analysis = pre_analyzed_blocks[block_idx];
-			for (std::size_t i = 0; i < analysis.size(); ++i) {
+			for (std::size_t i = 0; i < analysis.size() && global_idx < a_stack.size(); ++i) {
 				const auto& data = analysis[i];
-				a_log.critical(fmt::runtime(format), global_idx * sizeof(std::size_t), stack[global_idx], data);
+				a_log.critical(fmt::runtime(format), global_idx * sizeof(std::size_t), a_stack[global_idx], data->render());
 				++global_idx;
 			}
 		}
@@ -165,36 +253,31 @@ namespace Crash
 	// Print stack with on-the-fly analysis
 	void print_stack(
 		spdlog::logger& a_log,
-		const ::CONTEXT& a_context,
+		Introspection::AnalysisContext& a_analysis,
+		std::span<const std::size_t> a_stack,
 		std::span<const module_pointer> a_modules)
 	{
-		const auto stack_opt = get_stack_info(a_context);
-		if (!stack_opt) {
-			a_log.critical("STACK:"sv);
-			a_log.critical("\tFAILED TO READ TIB"sv);
-			return;
-		}
-		const auto& stack = *stack_opt;
-
-		const auto all_analysis_results = analyze_stack_blocks(stack, a_modules);
-		print_stack(a_log, a_context, a_modules, all_analysis_results);
+		const auto all_analysis_results = analyze_stack_blocks(a_analysis, a_stack, a_modules);
+		print_stack(a_log, a_stack, a_modules, all_analysis_results);
 	}
 
-	// Thread-dump-safe versions that use explicit stack bounds instead of TIB
+	// Thread-dump versions
 
 	// Analyze and print registers (thread-safe, same as regular version)
 	void print_registers_safe(
 		spdlog::logger& a_log,
+		Introspection::AnalysisContext& a_analysis,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules)
 	{
-		// Register analysis doesn't depend on TIB, so just call regular version
-		print_registers(a_log, a_context, a_modules);
+		// Register analysis doesn't read the stack, so just call regular version
+		print_registers(a_log, a_analysis, a_context, a_modules);
 	}
 
 	// Analyze and print stack with safe bounds (for thread dumps)
 	void print_stack_safe(
 		spdlog::logger& a_log,
+		Introspection::AnalysisContext& a_analysis,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules,
 		std::size_t max_stack_bytes)
@@ -202,7 +285,12 @@ namespace Crash
 		a_log.critical("STACK:"sv);
 
 		try {
-			const auto stack = get_stack_info_safe(a_context, max_stack_bytes);
+			const auto snapshot = StackSnapshot::capture(a_context, max_stack_bytes);
+			const auto stack = snapshot.words();
+			if (stack.empty()) {
+				a_log.critical("\tFAILED TO READ STACK"sv);
+				return;
+			}
 
 			const auto format = [&]() {
 				return "\t[RSP+{:<"s +
@@ -210,7 +298,7 @@ namespace Crash
 				       "X}] 0x{:<16X} {}"s;
 			}();
 
-			const auto all_analysis_results = analyze_stack_blocks(stack, a_modules);
+			const auto all_analysis_results = analyze_stack_blocks(a_analysis, stack, a_modules);
 
 			// Print the analyzed results
 			std::size_t global_idx = 0;
@@ -218,7 +306,7 @@ namespace Crash
 				const auto& analysis = all_analysis_results[block_idx];
 				for (std::size_t i = 0; i < analysis.size(); ++i) {
 					const auto& data = analysis[i];
-					a_log.critical(fmt::runtime(format), global_idx * sizeof(std::size_t), stack[global_idx], data);
+					a_log.critical(fmt::runtime(format), global_idx * sizeof(std::size_t), stack[global_idx], data->render());
 					++global_idx;
 				}
 			}
@@ -256,7 +344,8 @@ namespace Crash
 	void print_callstack_impl(
 		spdlog::logger& a_log,
 		std::span<const FrameData> a_frame_data,
-		std::string_view a_indent)
+		std::string_view a_indent,
+		bool a_firstIsInstructionPointer)
 	{
 		if (a_frame_data.empty()) {
 			a_log.critical("{}No stack frames available"sv, a_indent);
@@ -280,12 +369,17 @@ namespace Crash
 		for (std::size_t i = 0; i < a_frame_data.size(); ++i) {
 			try {
 				const auto& frame = a_frame_data[i];
+				// A frame outside every loaded module may be code from a DLL that was since unloaded
+				const auto unloaded = !frame.module && frame.frame_info.empty() ? Modules::describe_unloaded(frame.address) : ""s;
+				// Flag frames whose function a plugin has detoured or patched. Frame 0 may be the
+				// instruction pointer, every later frame is a return address.
+				const auto patched = Modules::describe_code_patches(frame.address, frame.module, i > 0 || !a_firstIsInstructionPointer);
 				a_log.critical(
 					fmt::runtime(format),
 					i,
 					reinterpret_cast<std::uintptr_t>(frame.address),
 					(frame.module ? frame.module->name() : ""sv),
-					frame.frame_info);
+					(unloaded.empty() ? frame.frame_info : unloaded) + patched);
 			} catch (...) {
 				a_log.critical("[Frame {} processing failed]", i);
 			}
@@ -318,47 +412,41 @@ namespace Crash
 
 	namespace
 	{
-		// Reseed a reliable virtual unwind from the return address a faulting CALL pushed at [RSP].
-		// Used to recover the true caller chain of a null/near-null indirect call, where the normal
-		// unwinder dead-ends because the fault frame's RIP (=0) has no unwind metadata.
+		// Virtually unwind from a_context, writing RIP and then each caller's return address into a_out.
+		// Frames with unwind data go through RtlVirtualUnwind; frames without it (leaf functions, and a
+		// call through a null/garbage pointer whose RIP has no code) pop their return address from [RSP].
+		// Function lookups share one UNWIND_HISTORY_TABLE, which caches the tables of recently hit images.
 		//
 		// Kept free of any object that requires unwinding (no std:: containers, no destructors) so
 		// the function is legal to wrap in __try/__except (MSVC C2712). Results are written into the
 		// caller-provided buffer, mirroring safe_collect_native_frames().
-		bool safe_reseed_unwind_from_rsp(const ::CONTEXT& a_context, void** a_out, std::size_t a_max, std::size_t& a_count) noexcept
+		bool safe_unwind(const ::CONTEXT& a_context, const void** a_out, std::size_t a_max, std::size_t& a_count) noexcept
 		{
 			a_count = 0;
 			__try {
-				// The faulting CALL pushed its return address at [RSP]; that is the real caller.
-				const auto retSlot = reinterpret_cast<void* const*>(a_context.Rsp);
-				void* const caller = *retSlot;  // may fault if RSP is invalid -> caught below
-				if (caller == nullptr || a_max == 0) {
-					return true;
-				}
-
-				// Synthesize a context positioned just past the faulting CALL and unwind from there.
 				::CONTEXT ctx = a_context;
-				ctx.Rip = reinterpret_cast<DWORD64>(caller);
-				ctx.Rsp = a_context.Rsp + sizeof(void*);
+				::UNWIND_HISTORY_TABLE history{};
 
-				a_out[a_count++] = caller;
+				while (a_count < a_max) {
+					a_out[a_count++] = reinterpret_cast<const void*>(ctx.Rip);
 
-				while (a_count < a_max && ctx.Rip != 0) {
+					const auto previousRsp = ctx.Rsp;
 					DWORD64 imageBase = 0;
-					auto* const fn = ::RtlLookupFunctionEntry(ctx.Rip, &imageBase, nullptr);
-					if (fn == nullptr) {
-						break;  // leaf function / no unwind data -> stop the reliable walk
+					auto* const fn = ::RtlLookupFunctionEntry(ctx.Rip, &imageBase, &history);
+					if (fn) {
+						PVOID handlerData = nullptr;
+						DWORD64 establisherFrame = 0;
+						::RtlVirtualUnwind(UNW_FLAG_NHANDLER, imageBase, ctx.Rip, fn, &ctx,
+							&handlerData, &establisherFrame, nullptr);
+					} else {
+						ctx.Rip = *reinterpret_cast<const DWORD64*>(ctx.Rsp);  // may fault if RSP is invalid -> caught below
+						ctx.Rsp += sizeof(DWORD64);
 					}
 
-					PVOID handlerData = nullptr;
-					DWORD64 establisherFrame = 0;
-					::RtlVirtualUnwind(UNW_FLAG_NHANDLER, imageBase, ctx.Rip, fn, &ctx,
-						&handlerData, &establisherFrame, nullptr);
-
-					if (ctx.Rip == 0) {
+					// The stack only grows up while unwinding; anything else is corruption
+					if (ctx.Rip == 0 || ctx.Rsp <= previousRsp) {
 						break;
 					}
-					a_out[a_count++] = reinterpret_cast<void*>(ctx.Rip);
 				}
 				return true;
 			} __except (EXCEPTION_EXECUTE_HANDLER) {
@@ -367,19 +455,59 @@ namespace Crash
 		}
 	}
 
+	std::size_t unwind_context(const ::CONTEXT& a_context, std::span<const void*> a_frames) noexcept
+	{
+		std::size_t count = 0;
+		safe_unwind(a_context, a_frames.data(), a_frames.size(), count);
+		return count;
+	}
+
+	std::vector<const void*> unwind_stack(const ::CONTEXT& a_context, std::size_t a_max_frames)
+	{
+		std::vector<const void*> frames(a_max_frames, nullptr);
+		frames.resize(unwind_context(a_context, frames));
+		return frames;
+	}
+
 	std::vector<const void*> recover_null_call_stack(const ::CONTEXT& a_context, std::size_t a_max_frames)
 	{
-		std::vector<const void*> result;
-		if (a_max_frames == 0) {
-			return result;
+		// Frame 0 is the bad RIP itself; with no unwind data there the walk pops the return address
+		// the faulting CALL pushed at [RSP], so everything after it is the real caller chain.
+		auto frames = unwind_stack(a_context, a_max_frames + 1);
+		if (!frames.empty()) {
+			frames.erase(frames.begin());
 		}
+		return frames;
+	}
 
-		std::vector<void*> buffer(a_max_frames, nullptr);
-		std::size_t count = 0;
-		if (safe_reseed_unwind_from_rsp(a_context, buffer.data(), a_max_frames, count)) {
-			result.assign(buffer.begin(), buffer.begin() + count);
+	bool is_plausible_return_address(
+		const void* a_address,
+		const Modules::Module* a_module)
+	{
+		if (!a_module || !a_module->in_range(a_address)) {
+			return false;
 		}
-		return result;
+
+		// A return address must land inside a function that has unwind data (its caller is
+		// not a leaf). Modules without .pdata fall back to checking page protection.
+		if (a_module->has_function_table()) {
+			if (!a_module->in_function(a_address)) {
+				return false;
+			}
+		} else {
+			MEMORY_BASIC_INFORMATION mbi{};
+			if (!VirtualQuery(a_address, &mbi, sizeof(mbi))) {
+				return false;
+			}
+			const auto protect = mbi.Protect & 0xFF;
+			const bool executable = protect == PAGE_EXECUTE || protect == PAGE_EXECUTE_READ ||
+			                        protect == PAGE_EXECUTE_READWRITE || protect == PAGE_EXECUTE_WRITECOPY;
+			if (!executable) {
+				return false;
+			}
+		}
+
+		return Disassembly::is_return_address(a_address);
 	}
 
 	std::vector<const void*> scan_stack_for_frames(
@@ -390,9 +518,20 @@ namespace Crash
 		std::vector<const void*> frames;
 		frames.reserve(std::min(a_max_frames, a_stack.size()));
 		std::unordered_set<const void*> seen;
+		if (a_modules.empty()) {
+			return frames;
+		}
 
-		for (const auto value : a_stack) {
-			if (value == 0) {
+		// Return addresses are pointers inside the span covered by loaded modules; the prefilter
+		// drops the rest in bulk so only those reach the per-module binary search
+		const auto lowest = a_modules.front()->address();
+		const auto highest = a_modules.back()->address() + a_modules.back()->size();
+		std::vector<StackWords::Candidate> candidates;
+		StackWords::prefilter(a_stack, candidates);
+
+		for (const auto& candidate : candidates) {
+			const auto value = a_stack[candidate.index];
+			if (!(candidate.kind & StackWords::Pointer) || value < lowest || value >= highest) {
 				continue;
 			}
 			const auto addr = reinterpret_cast<const void*>(value);
@@ -401,14 +540,7 @@ namespace Crash
 				continue;
 			}
 
-			MEMORY_BASIC_INFORMATION mbi{};
-			if (!VirtualQuery(addr, &mbi, sizeof(mbi))) {
-				continue;
-			}
-			const auto protect = mbi.Protect & 0xFF;
-			const bool executable = protect == PAGE_EXECUTE || protect == PAGE_EXECUTE_READ ||
-			                        protect == PAGE_EXECUTE_READWRITE || protect == PAGE_EXECUTE_WRITECOPY;
-			if (!executable) {
+			if (!is_plausible_return_address(addr, mod)) {
 				continue;
 			}
 			if (!seen.insert(addr).second) {
@@ -495,7 +627,7 @@ namespace Crash
 			}
 		}
 
-		print_callstack_impl(a_log, frame_data, "\t"sv);
+		print_callstack_impl(a_log, frame_data, "\t"sv, false);
 	}
 
 	void print_hybrid_callstack(
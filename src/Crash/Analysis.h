@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Crash/Introspection/Record.h"
 #include "Crash/Modules/ModuleHandler.h"
 
 namespace spdlog
@@ -9,6 +10,11 @@ namespace spdlog
 
 namespace Crash
 {
+	namespace Introspection
+	{
+		class AnalysisContext;
+	}
+
 	// Shared data structures for register and stack analysis
 
 	// Register information (name + value pairs)
@@ -18,63 +24,102 @@ namespace Crash
 	// Get register names and values from CONTEXT
 	[[nodiscard]] std::pair<RegisterInfo, RegisterValues> get_register_info(const ::CONTEXT& a_context);
 
-	// Get stack memory span from CONTEXT (using TIB of current thread)
-	// NOTE: Only valid for crash logs where CONTEXT is from current thread!
-	[[nodiscard]] std::optional<std::span<const std::size_t>> get_stack_info(const ::CONTEXT& a_context);
+	// Immutable, analysis-owned copy of a thread's stack from RSP upward. Taken once per crash log or
+	// thread, so every analyzer sees the same bytes and none of them touches live stack memory.
+	class StackSnapshot
+	{
+	public:
+		StackSnapshot() = default;
+
+		// Copy up to a_max_bytes from a_context.Rsp upward. Page-aware: the copy covers only committed,
+		// readable pages of the stack's own reservation and stops early (SEH-guarded) if one faults.
+		// Works for the crashing thread and for suspended threads alike.
+		[[nodiscard]] static StackSnapshot capture(const ::CONTEXT& a_context, std::size_t a_max_bytes = 1u << 20);
+
+		[[nodiscard]] std::span<const std::size_t> words() const noexcept { return _words; }
+		[[nodiscard]] std::uintptr_t rsp() const noexcept { return _rsp; }
+		[[nodiscard]] bool empty() const noexcept { return _words.empty(); }
+
+	private:
+		std::vector<std::size_t> _words;
+		std::uintptr_t _rsp{ 0 };
+	};
 
-	// Get stack memory span from CONTEXT with explicit max size (safe for thread dumps)
-	// Uses RSP from CONTEXT and scans up to max_bytes (default 64KB)
-	[[nodiscard]] std::span<const std::size_t> get_stack_info_safe(const ::CONTEXT& a_context, std::size_t max_bytes = 65536);
+	// Bound a_analysis by the introspection deadline and per-object budgets from the INI.
+	// The deadline counts from this call, so apply it right after creating the context.
+	void apply_introspection_limits(Introspection::AnalysisContext& a_analysis);
 
 	// Analyze register values with introspection
 	// Returns: pair of (register info, vector of analysis strings)
-	[[nodiscard]] std::pair<RegisterInfo, std::vector<std::string>> analyze_registers(
+	[[nodiscard]] std::pair<RegisterInfo, std::vector<Introspection::RecordHandle>> analyze_registers(
+		Introspection::AnalysisContext& a_analysis,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules);
 
 	// Analyze stack memory blocks with introspection
 	// Returns: vector of blocks, each block is a vector of analysis strings
-	[[nodiscard]] std::vector<std::vector<std::string>> analyze_stack_blocks(
+	[[nodiscard]] std::vector<std::vector<Introspection::RecordHandle>> analyze_stack_blocks(
+		Introspection::AnalysisContext& a_analysis,
 		std::span<const std::size_t> stack,
 		std::span<const module_pointer> a_modules);
 
+	// Registers and the top of the stack of one thread, introspected once and shared by every
+	// section that shows them (relevant objects, registers, stack) so all agree on "See" labels
+	struct ThreadAnalysis
+	{
+		RegisterInfo registers;
+		std::vector<Introspection::RecordHandle> registerAnalysis;         // parallel to registers
+		std::vector<std::vector<Introspection::RecordHandle>> stackBlocks;  // same layout as analyze_stack_blocks()
+	};
+
+	// Analyze registers and a_stack in one pass, then backfill both
+	[[nodiscard]] ThreadAnalysis analyze_thread(
+		Introspection::AnalysisContext& a_analysis,
+		const ::CONTEXT& a_context,
+		std::span<const std::size_t> a_stack,
+		std::span<const module_pointer> a_modules);
+
 	// Print registers with introspection
 	void print_registers(
 		spdlog::logger& a_log,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules,
-		const std::vector<std::string>& pre_analyzed);
+		const std::vector<Introspection::RecordHandle>& pre_analyzed);
 
 	// Print registers with on-the-fly analysis
 	void print_registers(
 		spdlog::logger& a_log,
+		Introspection::AnalysisContext& a_analysis,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules);
 
 	// Print stack with introspection
 	void print_stack(
 		spdlog::logger& a_log,
-		const ::CONTEXT& a_context,
+		std::span<const std::size_t> a_stack,
 		std::span<const module_pointer> a_modules,
-		const std::vector<std::vector<std::string>>& pre_analyzed_blocks);
+		const std::vector<std::vector<Introspection::RecordHandle>>& pre_analyzed_blocks);
 
 	// Print stack with on-the-fly analysis
 	void print_stack(
 		spdlog::logger& a_log,
-		const ::CONTEXT& a_context,
+		Introspection::AnalysisContext& a_analysis,
+		std::span<const std::size_t> a_stack,
 		std::span<const module_pointer> a_modules);
 
-	// Thread-dump-safe versions that use explicit stack bounds instead of TIB
+	// Thread-dump versions
 
 	// Analyze and print registers (thread-safe, same as regular version)
 	void print_registers_safe(
 		spdlog::logger& a_log,
+		Introspection::AnalysisContext& a_analysis,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules);
 
-	// Analyze and print stack with safe bounds (for thread dumps)
+	// Snapshot, analyze and print a (suspended) thread's stack, bounded to max_stack_bytes
 	void print_stack_safe(
 		spdlog::logger& a_log,
+		Introspection::AnalysisContext& a_analysis,
 		const ::CONTEXT& a_context,
 		std::span<const module_pointer> a_modules,
 		std::size_t max_stack_bytes = 65536);
@@ -97,10 +142,12 @@ namespace Crash
 
 	// Core callstack printing logic - shared by crash logs and thread dumps
 	// Takes pre-processed frame data and prints with consistent formatting
+	// a_firstIsInstructionPointer is false when every frame is a return address (stack scans)
 	void print_callstack_impl(
 		spdlog::logger& a_log,
 		std::span<const FrameData> a_frame_data,
-		std::string_view a_indent = "\t"sv);
+		std::string_view a_indent = "\t"sv,
+		bool a_firstIsInstructionPointer = true);
 
 	// Print a callstack from a list of addresses (for thread dumps)
 	void print_callstack(
@@ -108,6 +155,16 @@ namespace Crash
 		std::span<const void* const> a_frames,
 		std::span<const module_pointer> a_modules);
 
+	// Walk the stack described by a_context (an exception's CONTEXT or a suspended thread's) with
+	// RtlVirtualUnwind, falling back to popping [RSP] for frames without unwind data. a_frames[0] is
+	// a_context.Rip. SEH-guarded and allocation-free; returns the number of frames written.
+	std::size_t unwind_context(const ::CONTEXT& a_context, std::span<const void*> a_frames) noexcept;
+
+	// unwind_context() into a vector
+	[[nodiscard]] std::vector<const void*> unwind_stack(
+		const ::CONTEXT& a_context,
+		std::size_t a_max_frames = 128);
+
 	// Recover the real caller chain of a null/near-null indirect call (execute access violation at
 	// RIP≈0). The faulting CALL pushed its return address at [RSP], which has valid unwind metadata,
 	// so a reliable virtual unwind can be reseeded from it. Returns frames starting at the caller of
@@ -116,6 +173,13 @@ namespace Crash
 		const ::CONTEXT& a_context,
 		std::size_t a_max_frames = 128);
 
+	// Check whether a stack value could be a real return address into a_module: it must fall inside
+	// a known function body (.pdata, or executable memory if the module has none) and be preceded
+	// by a CALL instruction. Shared by the crash-log and thread-dump stack scanners.
+	[[nodiscard]] bool is_plausible_return_address(
+		const void* a_address,
+		const Modules::Module* a_module);
+
 	// Scan raw stack data for plausible return addresses and build a reconstructed callstack
 	[[nodiscard]] std::vector<const void*> scan_stack_for_frames(
 		std::span<const std::size_t> a_stack,
@@ -3,11 +3,17 @@
 #include "Crash/Analysis.h"
 #include "Crash/CommonHeader.h"
 #include "Crash/CppException.h"
+#include "Crash/Disassembly.h"
+#include "Crash/EmergencyArena.h"
 #include "Crash/Introspection/Introspection.h"
 #include "Crash/Introspection/RelevantObjectsSimplifier.h"
+#include "Crash/Modules/FileHashes.h"
 #include "Crash/Modules/ModuleHandler.h"
+#include "Crash/Modules/PluginVersions.h"
+#include "Crash/Modules/UnloadedModules.h"
 #include "Crash/PDB/PdbHandler.h"
 #include "Crash/ProblematicModules.h"
+#include "Crash/SafeMemory.h"
 #include "Crash/ThreadDump.h"
 #include "dxgi1_4.h"
 #include <Settings.h>
@@ -21,7 +27,6 @@
 #include <sstream>
 #include <thread>
 #include <vmaware.hpp>
-#include <wincrypt.h>
 #undef debug  // avoid conflict with vmaware.hpp debug
 using namespace vr;
 
@@ -104,27 +109,28 @@ namespace Crash
 
 	Callstack::Callstack(const ::EXCEPTION_RECORD& a_except, const ::CONTEXT* a_context)
 	{
+		// Unwind from the faulting CONTEXT rather than capturing from inside this handler, so the
+		// stack starts at the fault instead of the handler + OS exception-dispatch frames.
+		//
 		// Self-heal for a null / near-null EXECUTE access violation (a call through a null or
-		// garbage function pointer). RtlCaptureStackBackTrace, called from inside this handler,
-		// would return only the handler + OS exception-dispatch frames, because the faulting
-		// frame's RIP (=0) has no unwind metadata for the walk to cross. The faulting CALL did
-		// push its return address at [RSP], whose code has valid unwind data, so reseed a reliable
-		// unwind from there: the resulting frames ARE the real culprit chain. We replace the
-		// captured frames entirely so every consumer (hybrid stack, throw location, thread role)
-		// sees the corrected stack instead of the handler.
-		const auto exceptionIp = reinterpret_cast<std::uintptr_t>(a_except.ExceptionAddress);
-		const bool isNullCall =
-			a_except.ExceptionCode == EXCEPTION_ACCESS_VIOLATION &&
-			a_except.NumberParameters >= 1 &&
-			a_except.ExceptionInformation[0] == 8 &&  // execute
-			exceptionIp < 0x10000;
-
-		if (isNullCall && a_context) {
-			const auto recovered = recover_null_call_stack(*a_context);
-			if (!recovered.empty()) {
+		// garbage function pointer): the faulting frame's RIP (=0) has no unwind metadata, so the
+		// unwinder pops the return address the faulting CALL pushed at [RSP] and continues reliably
+		// from the real caller. recover_null_call_stack() drops the bogus RIP frame so every consumer
+		// (hybrid stack, throw location, thread role) sees the culprit chain first.
+		if (a_context) {
+			const auto exceptionIp = reinterpret_cast<std::uintptr_t>(a_except.ExceptionAddress);
+			const bool isNullCall =
+				a_except.ExceptionCode == EXCEPTION_ACCESS_VIOLATION &&
+				a_except.NumberParameters >= 1 &&
+				a_except.ExceptionInformation[0] == 8 &&  // execute
+				exceptionIp < 0x10000;
+
+			constexpr std::size_t MAX_DEPTH = 500;
+			const auto unwound = isNullCall ? recover_null_call_stack(*a_context, MAX_DEPTH) : unwind_stack(*a_context, MAX_DEPTH);
+			if (!unwound.empty()) {
 				_capturedFrames.clear();
-				_capturedFrames.reserve(recovered.size());
-				for (const auto addr : recovered) {
+				_capturedFrames.reserve(unwound.size());
+				for (const auto addr : unwound) {
 					_capturedFrames.emplace_back(addr);
 				}
 				_frames = std::span(_capturedFrames);
@@ -132,6 +138,7 @@ namespace Crash
 			}
 		}
 
+		// No usable CONTEXT: capture from here and trim to the exception address
 		auto [capturedFrames, success] = safe_capture_stacktrace();
 		_capturedFrames = std::move(capturedFrames);
 
@@ -198,13 +205,8 @@ namespace Crash
 				const auto mod = Introspection::get_module_for_pointer(addr, a_modules);
 
 				if (mod) {
-					const auto modName = mod->name();
 					// Skip system frames
-					if (modName.find("KERNELBASE") != std::string::npos ||
-						modName.find("VCRUNTIME") != std::string::npos ||
-						modName.find("ntdll") != std::string::npos ||
-						modName.find("KERNEL32") != std::string::npos ||
-						modName.find("ucrtbase") != std::string::npos) {
+					if (mod->kind() == Modules::Kind::System) {
 						continue;
 					}
 
@@ -242,6 +244,8 @@ namespace Crash
 				const auto mod = Introspection::get_module_for_pointer(addr, a_modules);
 				if (mod) {
 					results.push_back(fmt::format("{}{}", mod->name(), mod->frame_info(frame)));
+				} else if (auto unloaded = Modules::describe_unloaded(addr); !unloaded.empty()) {
+					results.push_back(std::move(unloaded));
 				} else {
 					results.push_back("<unknown>");
 				}
@@ -346,7 +350,7 @@ namespace Crash
 		struct RelevantObject
 		{
 			std::size_t address;
-			std::string full_analysis;  // Full introspection output
+			Introspection::RecordHandle full_analysis;  // Full introspection output, owned by the context
 			std::string location;       // Register name or stack offset
 			std::size_t distance;       // Lower = closer to exception (0 = in registers, 1+ = stack offset)
 		};
@@ -354,9 +358,10 @@ namespace Crash
 		// Collection to store interesting objects found during analysis
 		struct RelevantObjectsCollection
 		{
+			const Introspection::AnalysisContext& context;
 			std::map<std::size_t, RelevantObject> objects;
 
-			void add(std::size_t address, std::string full_analysis, std::string location, std::size_t distance)
+			void add(std::size_t address, Introspection::RecordHandle full_analysis, std::string location, std::size_t distance)
 			{
 				if (address == 0) {
 					return;
@@ -364,13 +369,12 @@ namespace Crash
 
 				// Check if this address has game introspection data
 				// FormIDs are always considered relevant as they imply successful introspection
-				const bool is_form_id = full_analysis.starts_with("(FormID");
-				if (!is_form_id && !Introspection::was_introspected(reinterpret_cast<const void*>(address))) {
+				if (!full_analysis->viaFormID && !context.was_introspected(reinterpret_cast<const void*>(address))) {
 					return;
 				}
 
 				// Skip cross-references ("See RSP+XX") - we only want the first full occurrence
-				if (full_analysis.find(" See ") != std::string::npos) {
+				if (full_analysis->is_cross_reference()) {
 					return;
 				}
 
@@ -378,10 +382,11 @@ namespace Crash
 				auto it = objects.find(address);
 				if (it == objects.end()) {
 					// First time seeing this address
-					objects[address] = { address, std::move(full_analysis), std::move(location), distance };
+					objects[address] = { address, full_analysis, std::move(location), distance };
+					context.records().note_shared(full_analysis);
 				} else if (distance < it->second.distance) {
 					// Found a closer occurrence, replace it
-					it->second = { address, std::move(full_analysis), std::move(location), distance };
+					it->second = { address, full_analysis, std::move(location), distance };
 				}
 				// Otherwise, keep the existing closer occurrence
 			}
@@ -411,91 +416,6 @@ namespace Crash
 				name(std::move(section_name)) {}
 		};
 
-		[[nodiscard]] std::string get_file_md5(const std::filesystem::path& filepath)
-		{
-			const auto get_error_message = [](DWORD error) -> std::string {
-				if (error == 0)
-					return "No error";
-
-				LPSTR messageBuffer = nullptr;
-				const auto size = FormatMessageA(
-					FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
-					nullptr, error, MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
-					reinterpret_cast<LPSTR>(&messageBuffer), 0, nullptr);
-
-				if (size == 0) {
-					return fmt::format("Error {:#x}", error);
-				}
-
-				std::string message(messageBuffer, size);
-				LocalFree(messageBuffer);
-
-				// Remove trailing newlines
-				while (!message.empty() && (message.back() == '\n' || message.back() == '\r')) {
-					message.pop_back();
-				}
-
-				return fmt::format("Error {:#x}: {}", error, message);
-			};
-
-			try {
-				std::ifstream file(filepath, std::ios::binary);
-				if (!file) {
-					const auto error = GetLastError();
-					return fmt::format("<file not accessible - {}>", get_error_message(error));
-				}
-
-				HCRYPTPROV hProv = 0;
-				HCRYPTHASH hHash = 0;
-
-				if (!CryptAcquireContext(&hProv, nullptr, nullptr, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT)) {
-					const auto error = GetLastError();
-					return fmt::format("<CryptAcquireContext failed - {}>", get_error_message(error));
-				}
-
-				if (!CryptCreateHash(hProv, CALG_MD5, 0, 0, &hHash)) {
-					const auto error = GetLastError();
-					CryptReleaseContext(hProv, 0);
-					return fmt::format("<CryptCreateHash failed - {}>", get_error_message(error));
-				}
-
-				constexpr size_t BUFSIZE = 8192;
-				char buffer[BUFSIZE];
-				while (file.read(buffer, BUFSIZE) || file.gcount() > 0) {
-					if (!CryptHashData(hHash, reinterpret_cast<BYTE*>(buffer),
-							static_cast<DWORD>(file.gcount()), 0)) {
-						const auto error = GetLastError();
-						CryptDestroyHash(hHash);
-						CryptReleaseContext(hProv, 0);
-						return fmt::format("<CryptHashData failed - {}>", get_error_message(error));
-					}
-				}
-
-				DWORD dwHashLen = 16;  // MD5 is always 16 bytes
-				BYTE hash[16];
-				if (!CryptGetHashParam(hHash, HP_HASHVAL, hash, &dwHashLen, 0)) {
-					const auto error = GetLastError();
-					CryptDestroyHash(hHash);
-					CryptReleaseContext(hProv, 0);
-					return fmt::format("<CryptGetHashParam failed - {}>", get_error_message(error));
-				}
-
-				CryptDestroyHash(hHash);
-				CryptReleaseContext(hProv, 0);
-
-				std::stringstream ss;
-				ss << std::hex << std::setfill('0');
-				for (int i = 0; i < 16; ++i) {
-					ss << std::setw(2) << static_cast<unsigned>(hash[i]);
-				}
-				return ss.str();
-			} catch (const std::exception& e) {
-				return fmt::format("<exception: {}>", e.what());
-			} catch (...) {
-				return "<unknown exception>";
-			}
-		}
-
 		std::optional<std::size_t> get_register_value(const ::CONTEXT& a_context, ZydisRegister reg)
 		{
 			const auto fullReg = ZydisRegisterGetLargestEnclosing(ZYDIS_MACHINE_MODE_LONG_64, reg);
@@ -581,19 +501,9 @@ namespace Crash
 
 			ZydisDisassembledInstruction instruction{};
 
-			// Guard against reading invalid memory at ExceptionAddress
-			// If IP itself is corrupt, ZydisDisassembleIntel could trigger secondary AV
-			__try {
-				if (!ZYAN_SUCCESS(ZydisDisassembleIntel(
-						/* machine_mode:    */ ZYDIS_MACHINE_MODE_LONG_64,
-						/* runtime_address: */ reinterpret_cast<ZyanU64>(ip),
-						/* buffer:          */ reinterpret_cast<const ZyanU8*>(ip),
-						/* length:          */ 16,
-						/* instruction:     */ &instruction))) {
-					return;
-				}
-			} __except (EXCEPTION_EXECUTE_HANDLER) {
-				// Failed to read instruction bytes; IP likely points to unmapped/protected memory
+			// Instruction bytes are read through a guarded copy, so a corrupt IP can't trigger a secondary AV
+			if (!Disassembly::disassemble(ip, instruction)) {
+				// IP likely points to unmapped/protected memory
 				a_log.critical("ACCESS VIOLATION ANALYSIS: Unable to disassemble instruction at 0x{:016X} (memory not readable)"sv,
 					reinterpret_cast<std::uintptr_t>(ip));
 				return;
@@ -757,11 +667,12 @@ namespace Crash
 						// Use existing introspection system to analyze the exception object
 						try {
 							const std::size_t addresses[] = { cppExInfo->objectAddress };
-							const auto analysis = Introspection::analyze_data(addresses, a_modules);
+							Introspection::AnalysisContext context{ EmergencyArena::resource() };
+							const auto analysis = Introspection::analyze_data(context, addresses, a_modules);
 
-							if (!analysis.empty() && !analysis[0].empty()) {
+							if (!analysis.empty() && !analysis[0]->header.empty()) {
 								// The introspection system provides full type information with details
-								a_log.critical("\tType: {}"sv, analysis[0]);
+								a_log.critical("\tType: {}"sv, analysis[0]->render());
 							} else {
 								// Fallback to our manual parsing if introspection fails
 								a_log.critical("\tType: {}"sv, cppExInfo->typeName);
@@ -813,10 +724,11 @@ namespace Crash
 					try {
 						const auto param = a_exception.ExceptionInformation[i];
 						const std::size_t params[] = { param };
-						const auto analysis = Introspection::analyze_data(params, a_modules);
+						Introspection::AnalysisContext context{ EmergencyArena::resource() };
+						const auto analysis = Introspection::analyze_data(context, params, a_modules);
 
-						if (!analysis.empty() && !analysis[0].empty()) {
-							a_log.critical("\tParameter[{}]: 0x{:012X} {}"sv, i, param, analysis[0]);
+						if (!analysis.empty() && !analysis[0]->header.empty()) {
+							a_log.critical("\tParameter[{}]: 0x{:012X} {}"sv, i, param, analysis[0]->render());
 						} else {
 							a_log.critical("\tParameter[{}]: 0x{:012X}"sv, i, param);
 						}
@@ -853,97 +765,16 @@ namespace Crash
 				return cmp == 0 && a_lhs.length() != a_rhs.length() ? a_lhs.length() < a_rhs.length() : cmp < 0;
 			};
 
-			const auto modules = [&]() {
-				std::set<std::string_view, decltype(ci)> result;
-				for (const auto& mod : a_modules) {
-					result.insert(mod->name());
-				}
-
-				return result;
-			}();
-
-			// Helper: attempt to read FileVersion string from version resource
-			auto get_file_version_string = [&](const std::filesystem::path& filename) -> std::optional<std::string> {
-				DWORD handle = 0;
-				const auto pathW = filename.wstring();
-				const auto size = GetFileVersionInfoSizeW(pathW.c_str(), &handle);
-				if (size == 0)
-					return std::nullopt;
-
-				std::vector<std::byte> data(size);
-				if (!GetFileVersionInfoW(pathW.c_str(), handle, size, data.data()))
-					return std::nullopt;
-
-				// Try StringFileInfo translation entry first
-				struct LANGANDCODEPAGE
-				{
-					WORD wLanguage;
-					WORD wCodePage;
-				};
-				LANGANDCODEPAGE* trans = nullptr;
-				UINT transLen = 0;
-				if (VerQueryValueW(data.data(), L"\\VarFileInfo\\Translation", reinterpret_cast<LPVOID*>(&trans), &transLen) && transLen >= sizeof(LANGANDCODEPAGE)) {
-					wchar_t block[64];
-					swprintf(block, std::size(block), L"\\StringFileInfo\\%04x%04x\\FileVersion", trans[0].wLanguage, trans[0].wCodePage);
-					LPWSTR value = nullptr;
-					UINT valueLen = 0;
-					if (VerQueryValueW(data.data(), block, reinterpret_cast<LPVOID*>(&value), &valueLen) && valueLen > 0) {
-						std::wstring ws(value, valueLen);
-						// trim trailing whitespace/newlines
-						while (!ws.empty() && iswspace(ws.back())) ws.pop_back();
-						return util::utf16_to_utf8(ws).value_or(std::string());
-					}
-				}
-
-				// Fallback: use fixed file info
-				VS_FIXEDFILEINFO* ffi = nullptr;
-				UINT ffiLen = 0;
-				if (VerQueryValueW(data.data(), L"\\", reinterpret_cast<LPVOID*>(&ffi), &ffiLen) && ffi) {
-					const auto major = HIWORD(ffi->dwFileVersionMS);
-					const auto minor = LOWORD(ffi->dwFileVersionMS);
-					const auto build = HIWORD(ffi->dwFileVersionLS);
-					const auto rev = LOWORD(ffi->dwFileVersionLS);
-					return fmt::format("{}.{}.{}.{}", major, minor, build, rev);
-				}
-
-				return std::nullopt;
-			};
+			auto plugins = Modules::get_plugin_versions(a_modules);
+			std::sort(plugins.begin(), plugins.end(),
+				[=](const Modules::PluginInfo& a_lhs, const Modules::PluginInfo& a_rhs) { return ci(a_lhs.name, a_rhs.name); });
 
-			struct PluginInfo
-			{
-				std::string name;
-				std::optional<REL::Version> version;
-				std::optional<std::string> version_str;  // fallback raw/string version
+			// Only what was hashed at startup; never read plugin files from the crash handler
+			const auto fingerprint = [](const Modules::PluginInfo& a_plugin) {
+				const auto hash = Modules::get_cached_file_hash(std::filesystem::path{ a_plugin.path });
+				return hash ? fmt::format(" [{}]", hash->xxh3) : ""s;
 			};
 
-			std::vector<PluginInfo> plugins;
-			for (const auto& m : modules) {
-				try {
-					std::filesystem::path pluginDir{ Crash::PDB::sPluginPath };
-					std::filesystem::path filename = pluginDir;
-					filename.append(m);
-					if (std::filesystem::exists(filename)) {
-						try {
-							plugins.push_back({ std::string(m), REL::GetFileVersion(filename.wstring()), std::nullopt });
-						} catch (const std::exception&) {
-							// Fallback: try to read whatever version string we can from the file resources
-							auto vs = get_file_version_string(filename);
-							if (vs) {
-								plugins.push_back({ std::string(m), std::nullopt, *vs });
-							} else {
-								plugins.push_back({ std::string(m), std::nullopt, std::nullopt });
-							}
-						}
-					}
-				} catch (const std::exception& e) {
-					a_log.critical("Skipping module {}:{}"sv, m, e.what());
-				} catch (...) {
-					a_log.critical("Skipping module {}:<unknown error>"sv, m);
-				}
-			}
-			std::sort(plugins.begin(), plugins.end(),
-				[=](const PluginInfo& a_lhs, const PluginInfo& a_rhs) { return ci(a_lhs.name, a_rhs.name); });
-
 			for (const auto& p : plugins) {
 				if (p.version) {
 					const auto ver = [&]() {
@@ -964,11 +795,11 @@ namespace Crash
 						}
 						return ""s;
 					}();
-					a_log.critical("\t{}{}"sv, p.name, ver);
+					a_log.critical("\t{}{}{}"sv, p.name, ver, fingerprint(p));
 				} else if (p.version_str) {
-					a_log.critical("\t{} v{}"sv, p.name, *p.version_str);
+					a_log.critical("\t{} v{}{}"sv, p.name, *p.version_str, fingerprint(p));
 				} else {
-					a_log.critical("\t{}"sv, p.name);
+					a_log.critical("\t{}{}"sv, p.name, fingerprint(p));
 				}
 			}
 		}
@@ -993,6 +824,68 @@ namespace Crash
 			}
 		}
 
+		void print_unloaded_modules(spdlog::logger& a_log)
+		{
+			const auto unloaded = Modules::get_unloaded_modules();
+			if (unloaded.empty()) {
+				return;
+			}
+
+			a_log.critical("UNLOADED MODULES:"sv);
+
+			std::size_t width = 0;
+			for (const auto& mod : unloaded) {
+				width = std::max(width, mod.name.length());
+			}
+			const auto format = "\t{:<"s + fmt::to_string(width) + "} 0x{:012X} - 0x{:012X}{}"s;
+
+			for (const auto& mod : unloaded) {
+				std::string when;
+				if (mod.unloadedAt) {
+					const auto time_t_val = std::chrono::system_clock::to_time_t(*mod.unloadedAt);
+					std::tm tm_val{};
+					if (localtime_s(&tm_val, &time_t_val) == 0) {
+						when = fmt::format("\tunloaded {:04}-{:02}-{:02} {:02}:{:02}:{:02}"sv,
+							tm_val.tm_year + 1900, tm_val.tm_mon + 1, tm_val.tm_mday,
+							tm_val.tm_hour, tm_val.tm_min, tm_val.tm_sec);
+					}
+				}
+				a_log.critical(fmt::runtime(format), mod.name, mod.base, mod.base + mod.size, when);
+			}
+		}
+
+		// Values the introspection deadline left unanalyzed, and objects cut short by their budget
+		void print_skipped_introspection(spdlog::logger& a_log, const Introspection::AnalysisContext& a_analysis)
+		{
+			const auto skipped = a_analysis.skipped();
+			const auto truncated = a_analysis.truncated();
+			if (skipped.empty() && truncated == 0) {
+				return;
+			}
+			if (!skipped.empty()) {
+				a_log.critical("INTROSPECTION DEADLINE REACHED: {} values printed without analysis:"sv, skipped.size());
+				std::string labels;
+				for (const auto& label : skipped) {
+					labels += labels.empty() ? label : ", "s + label;
+				}
+				a_log.critical("\t{}"sv, labels);
+			}
+			if (truncated > 0) {
+				a_log.critical("Introspection: details of {} objects truncated by the per-object time or depth budget"sv, truncated);
+			}
+		}
+
+		void print_arena_usage(spdlog::logger& a_log)
+		{
+			const auto arena = EmergencyArena::usage();
+			if (arena.capacity == 0) {
+				a_log.critical("Emergency arena: not reserved, crash log used the process heap"sv);
+				return;
+			}
+			a_log.critical("Emergency arena: peak {:.1f} KB of {} MB ({} allocations, {} heap fallbacks)"sv,
+				arena.peak / 1024.0, arena.capacity >> 20, arena.allocations, arena.fallbacks);
+		}
+
 		void print_plugins(spdlog::logger& a_log)
 		{
 			a_log.critical("PLUGINS:"sv);
@@ -1035,7 +928,7 @@ namespace Crash
 					for (std::size_t i = 0; i < objectCount; ++i) {
 						const auto& obj = sortedObjects[i];
 						// Simplify the full analysis for concise display
-						const auto simplified = Introspection::simplify_for_relevant_objects(obj.full_analysis);
+						const auto simplified = Introspection::simplify_for_relevant_objects(*obj.full_analysis);
 						if (!simplified.empty()) {
 							a_log.critical("\t{}: {}"sv, obj.location, simplified);
 						}
@@ -1216,8 +1109,11 @@ namespace Crash
 				wchar_t exePath[MAX_PATH];
 				if (GetModuleFileNameW(nullptr, exePath, MAX_PATH)) {
 					const std::filesystem::path exe_path(exePath);
-					const auto hash = get_file_md5(exe_path);
-					a_log.critical("\tExecutable MD5: {}"sv, hash);
+					// Normally hashed in the background at startup; only a crash that beats it pays for the read
+					auto cached = Modules::get_cached_file_hash(exe_path);
+					const auto hash = cached ? std::move(*cached) : Modules::hash_file(exe_path);
+					a_log.critical("\tExecutable MD5: {}"sv, hash.md5);
+					a_log.critical("\tExecutable XXH3: {}"sv, hash.xxh3);
 
 					// Also get file size and timestamp
 					std::error_code ec;
@@ -1488,8 +1384,12 @@ next_label:;
 				static std::mutex sync;
 				const std::lock_guard l{ sync };
 
+				Disassembly::reset_cache();
+				SafeMemory::reset();
+
 				const auto modules = Modules::get_loaded_modules();
 				const std::span cmodules{ modules.begin(), modules.end() };
+				Modules::snapshot_unloaded_modules(cmodules);
 				auto [logPtr, logPath] = get_timestamped_log("crash-"sv, "crash log"s);
 				log = logPtr;
 				crashLogPath = logPath;
@@ -1514,15 +1414,19 @@ next_label:;
 					}
 				}
 
+				// One analysis for the whole crash log: objects seen in the registers are cross-referenced from the stack.
+				// Its tables and records live in the pre-reserved arena rather than the possibly damaged process heap.
+				Introspection::AnalysisContext introspection{ EmergencyArena::resource() };
+				apply_introspection_limits(introspection);
+
 				// Collection to gather relevant objects during analysis
-				RelevantObjectsCollection relevantObjects;
+				RelevantObjectsCollection relevantObjects{ introspection };
 
 				const auto print = [&](auto&& a_functor, std::string a_name = "") {
 					log->critical(""sv);
 					try {
-						// Add timeout protection to prevent hanging on bad operations
+						// Introspection enforces its own deadline (apply_introspection_limits); this only reports
 						auto start = std::chrono::steady_clock::now();
-						constexpr auto timeout = std::chrono::seconds(30);
 
 						a_functor();
 
@@ -1563,28 +1467,31 @@ next_label:;
 
 				print([&]() { print_exception(*log, *a_exception->ExceptionRecord, cmodules, throwLocation, a_exception->ContextRecord); }, "print_exception");
 
-				// Reset introspection state once per crash (before all analysis)
-				Introspection::reset_analysis_state();
+				// Copy the faulting stack once; every section below analyzes this snapshot
+				const auto stackSnapshot = StackSnapshot::capture(*a_exception->ContextRecord);
+				const auto stack = stackSnapshot.words();
 
-				// Collect relevant objects from registers and stack (fast pass, no printing)
+				// Introspect registers and the top of the stack once; relevant objects, registers and
+				// stack sections all print from this, so their "See RSP+XX" references agree
+				std::optional<ThreadAnalysis> threadAnalysis;
 				try {
-					// Collect from registers
-					const auto [regs, regAnalysis] = analyze_registers(*a_exception->ContextRecord, cmodules);
-					for (std::size_t i = 0; i < regs.size(); ++i) {
-						relevantObjects.add(regs[i].second, regAnalysis[i], std::string(regs[i].first), 0);
-					}
+					constexpr std::size_t MAX_SCAN = 512;
+					threadAnalysis = analyze_thread(introspection, *a_exception->ContextRecord,
+						stack.subspan(0, std::min(stack.size(), MAX_SCAN)), cmodules);
+				} catch (...) {
+					// Analysis failed; the sections below fall back to analyzing on their own
+				}
 
-					// Collect from stack (limited to first 512 entries)
-					const auto stack_opt = get_stack_info(*a_exception->ContextRecord);
-					if (stack_opt) {
-						const auto& stack = *stack_opt;
-						constexpr std::size_t MAX_SCAN = 512;
-						const auto limited_stack = stack.subspan(0, std::min(stack.size(), MAX_SCAN));
-						const auto stack_analyses = analyze_stack_blocks(limited_stack, cmodules);
+				// Collect relevant objects from registers and stack (no printing)
+				try {
+					if (threadAnalysis) {
+						const auto& regs = threadAnalysis->registers;
+						for (std::size_t i = 0; i < regs.size(); ++i) {
+							relevantObjects.add(regs[i].second, threadAnalysis->registerAnalysis[i], std::string(regs[i].first), 0);
+						}
 
 						std::size_t global_idx = 0;
-						for (std::size_t block_idx = 0; block_idx < stack_analyses.size(); ++block_idx) {
-							const auto& analysis = stack_analyses[block_idx];
+						for (const auto& analysis : threadAnalysis->stackBlocks) {
 							for (std::size_t idx = 0; idx < analysis.size(); ++idx) {
 								const auto distance = global_idx * sizeof(std::size_t);
 								relevantObjects.add(stack[global_idx], analysis[idx],
@@ -1614,16 +1521,15 @@ next_label:;
 							callstack_ptr = &fallback;
 						}
 
-						const auto stack_opt = get_stack_info(*a_exception->ContextRecord);
-						if (!stack_opt) {
+						if (stack.empty()) {
 							log->critical("CALL STACK (HYBRID):");
-							log->critical("\tFAILED TO READ TIB");
+							log->critical("\tFAILED TO READ STACK");
 							callstack_ptr->print(*log, cmodules);
 							return;
 						}
 
 						const auto probable_frames = callstack_ptr->get_frame_addresses();
-						print_hybrid_callstack(*log, probable_frames, *stack_opt, cmodules);
+						print_hybrid_callstack(*log, probable_frames, stack, cmodules);
 					} catch (const std::bad_alloc&) {
 						log->critical("CALLSTACK ANALYSIS FAILED: Out of memory");
 					} catch (...) {
@@ -1639,59 +1545,36 @@ next_label:;
 				},
 					"hybrid_callstack");
 
-				// Analyze registers and stack first, then backfill, then print
-				try {
-					// Helper struct for uniform backfill processing
-					struct AnalysisBlock
-					{
-						std::vector<std::string> analysis;
-						std::span<const std::size_t> addresses;
-					};
-					std::vector<AnalysisBlock> allBlocks;
-
-					// Analyze registers
-					const auto [regs, regAnalysis] = analyze_registers(*a_exception->ContextRecord, cmodules);
-					const auto [dummy_regs, regValues] = get_register_info(*a_exception->ContextRecord);
-					allBlocks.push_back({ regAnalysis, regValues });
-
-					// Analyze stack blocks
-					const auto stack_opt = get_stack_info(*a_exception->ContextRecord);
-					if (stack_opt) {
-						const auto& stack = *stack_opt;
-						constexpr std::size_t MAX_SCAN = 512;
-						const auto scanSize = std::min(stack.size(), MAX_SCAN);
-
-						constexpr std::size_t blockSize = 256;
-						for (std::size_t off = 0; off < scanSize; off += blockSize) {
-							auto block = stack.subspan(off, std::min<std::size_t>(scanSize - off, blockSize));
-							auto analysis = Introspection::analyze_data(block, cmodules, [&](size_t i) { return fmt::format("RSP+{:X}", (off + i) * sizeof(std::size_t)); });
-							allBlocks.push_back({ std::move(analysis), block });
-						}
-					}
-
-					// Backfill all analyzed data uniformly
-					for (auto& block : allBlocks) {
-						Introspection::backfill_void_pointers(block.analysis, block.addresses);
-					}
-
-					// Extract backfilled results for printing
-					auto& finalRegAnalysis = allBlocks[0].analysis;
-					std::vector<std::vector<std::string>> stackAnalyses;
-					for (size_t i = 1; i < allBlocks.size(); ++i) {
-						stackAnalyses.push_back(std::move(allBlocks[i].analysis));
-					}
-
+				if (threadAnalysis) {
 					// Print with pre-analyzed data
-					print([&]() { print_registers(*log, *a_exception->ContextRecord, cmodules, finalRegAnalysis); }, "print_registers");
-					print([&]() { print_stack(*log, *a_exception->ContextRecord, cmodules, stackAnalyses); }, "print_raw_stack");
-				} catch (...) {
+					print([&]() { print_registers(*log, *a_exception->ContextRecord, cmodules, threadAnalysis->registerAnalysis); }, "print_registers");
+					print([&]() { print_stack(*log, stack, cmodules, threadAnalysis->stackBlocks); }, "print_raw_stack");
+				} else {
 					// Fallback to original behavior if analysis fails
-					print([&]() { print_registers(*log, *a_exception->ContextRecord, cmodules); }, "print_registers");
-					print([&]() { print_stack(*log, *a_exception->ContextRecord, cmodules); }, "print_raw_stack");
+					print([&]() { print_registers(*log, introspection, *a_exception->ContextRecord, cmodules); }, "print_registers");
+					print([&]() { print_stack(*log, introspection, stack, cmodules); }, "print_raw_stack");
+				}
+				if (const auto mem = SafeMemory::stats(); mem.reads > 0) {
+					logger::info("SafeMemory: {} reads, {} rejected by region map (exceptions avoided), {} faulted, {} VirtualQuery calls"sv,
+						mem.reads, mem.rejected, mem.faulted, mem.queries);
+				}
+				print([&]() { print_skipped_introspection(*log, introspection); }, "print_skipped_introspection");
+				logger::info("Introspection: {} contended seen-objects lock acquisitions"sv, introspection.lock_contention());
+				if (const auto [rejected, memoized] = introspection.form_id_usage(); rejected + memoized > 0) {
+					logger::info("Introspection: {} values rejected as FormIDs by plugin index, {} FormID lookups reused"sv, rejected, memoized);
+				}
+				if (const auto [classes, reused] = introspection.filter_plan_usage(); classes > 0) {
+					logger::info("Introspection: filter plans for {} classes, reused by {} objects"sv, classes, reused);
+				}
+				if (const auto pool = introspection.records().stats(); pool.records > 0) {
+					logger::info("Introspection: {} records stored once ({:.1f} KB), {:.1f} KB of record copies avoided by sharing"sv,
+						pool.records, pool.bytes / 1024.0, pool.sharedBytes / 1024.0);
 				}
 				print([&]() { print_modules(*log, cmodules); }, "print_modules");
+				print([&]() { print_unloaded_modules(*log); }, "print_unloaded_modules");
 				print([&]() { print_xse_plugins(*log, cmodules); }, "print_xse_plugins");
 				print([&]() { print_plugins(*log); }, "print_plugins");
+				print([&]() { print_arena_usage(*log); }, "print_arena_usage");
 
 				// Ensure all log data is written to disk before we try to open the file
 				log->flush();
@@ -1826,6 +1709,12 @@ next_label:;
 			::SetThreadStackGuarantee(&stackGuarantee);
 		}
 
+		// Reserve crash-time memory now, while the heap is still healthy
+		EmergencyArena::install();
+
+		// Record DLL unloads so stale pointers into freed modules can be named in crash logs
+		Modules::install_unload_tracking();
+
 		// Install crash handlers
 		const auto success =
 			::AddVectoredExceptionHandler(1, reinterpret_cast<::PVECTORED_EXCEPTION_HANDLER>(&VectoredExceptions));
@@ -15,8 +15,8 @@ namespace Crash
 	class Callstack
 	{
 	public:
-		// a_context (the faulting CONTEXT) enables self-healing the call stack for null
-		// function-pointer calls by reseeding the unwind from [RSP]; pass it when available.
+		// a_context (the faulting CONTEXT) is unwound directly, which keeps handler frames out of
+		// the stack and self-heals null function-pointer calls; pass it when available.
 		Callstack(const ::_EXCEPTION_RECORD& a_except, const ::_CONTEXT* a_context = nullptr);
 
 		void print(
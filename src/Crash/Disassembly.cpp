@@ -0,0 +1,160 @@
+#include "Crash/Disassembly.h"
+
+#include <Windows.h>
+#include <unordered_map>
+
+namespace Crash::Disassembly
+{
+	namespace
+	{
+		// Zydis setup is not free, so each thread keeps one initialized decoder/formatter pair
+		struct Context
+		{
+			Context() noexcept
+			{
+				ready = ZYAN_SUCCESS(ZydisDecoderInit(&decoder, ZYDIS_MACHINE_MODE_LONG_64, ZYDIS_STACK_WIDTH_64)) &&
+				        ZYAN_SUCCESS(ZydisFormatterInit(&formatter, ZYDIS_FORMATTER_STYLE_INTEL));
+			}
+
+			ZydisDecoder decoder{};
+			ZydisFormatter formatter{};
+			bool ready{ false };
+		};
+
+		[[nodiscard]] const Context& get_context() noexcept
+		{
+			static thread_local const Context context;
+			return context;
+		}
+
+		// Copy up to a_max bytes, stopping at the first byte that faults (e.g. an instruction
+		// straddling into an unmapped page). Kept free of objects that require unwinding so
+		// it can use __try/__except (MSVC C2712).
+		std::size_t safe_read(const void* a_src, std::uint8_t* a_dst, std::size_t a_max) noexcept
+		{
+			std::size_t copied = 0;
+			__try {
+				const auto src = static_cast<const volatile std::uint8_t*>(a_src);
+				for (; copied < a_max; ++copied) {
+					a_dst[copied] = src[copied];
+				}
+			} __except (EXCEPTION_EXECUTE_HANDLER) {
+			}
+			return copied;
+		}
+
+		std::unordered_map<std::uintptr_t, std::string> cache;
+		std::unordered_map<std::uintptr_t, bool> call_site_cache;
+		std::mutex cache_mutex;
+	}
+
+	bool disassemble(const void* a_address, ZydisDisassembledInstruction& a_instruction) noexcept
+	{
+		const auto& context = get_context();
+		if (!context.ready || !a_address) {
+			return false;
+		}
+
+		std::uint8_t bytes[MAX_INSTRUCTION_LENGTH]{};
+		const auto length = safe_read(a_address, bytes, std::size(bytes));
+		if (length == 0) {
+			return false;
+		}
+
+		a_instruction = {};
+		a_instruction.runtime_address = reinterpret_cast<ZyanU64>(a_address);
+		if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(&context.decoder, bytes, length, &a_instruction.info, a_instruction.operands))) {
+			return false;
+		}
+
+		return ZYAN_SUCCESS(ZydisFormatterFormatInstruction(
+			&context.formatter,
+			&a_instruction.info,
+			a_instruction.operands,
+			a_instruction.info.operand_count_visible,
+			a_instruction.text,
+			sizeof(a_instruction.text),
+			a_instruction.runtime_address,
+			ZYAN_NULL));
+	}
+
+	std::optional<Branch> branch_target(const void* a_address) noexcept
+	{
+		ZydisDisassembledInstruction instruction;
+		if (!disassemble(a_address, instruction)) {
+			return std::nullopt;
+		}
+
+		const auto mnemonic = instruction.info.mnemonic;
+		if ((mnemonic != ZYDIS_MNEMONIC_JMP && mnemonic != ZYDIS_MNEMONIC_CALL) || instruction.info.operand_count_visible != 1) {
+			return std::nullopt;
+		}
+
+		const auto& operand = instruction.operands[0];
+		ZyanU64 destination = 0;
+		if (operand.type == ZYDIS_OPERAND_TYPE_IMMEDIATE && operand.imm.is_relative) {
+			if (!ZYAN_SUCCESS(ZydisCalcAbsoluteAddress(&instruction.info, &operand, instruction.runtime_address, &destination))) {
+				return std::nullopt;
+			}
+		} else if (operand.type == ZYDIS_OPERAND_TYPE_MEMORY && operand.mem.base == ZYDIS_REGISTER_RIP && operand.mem.index == ZYDIS_REGISTER_NONE) {
+			ZyanU64 slot = 0;
+			if (!ZYAN_SUCCESS(ZydisCalcAbsoluteAddress(&instruction.info, &operand, instruction.runtime_address, &slot))) {
+				return std::nullopt;
+			}
+			std::uint8_t bytes[sizeof(ZyanU64)]{};
+			if (safe_read(reinterpret_cast<const void*>(slot), bytes, sizeof(bytes)) != sizeof(bytes)) {
+				return std::nullopt;
+			}
+			destination = std::bit_cast<ZyanU64>(bytes);
+		} else {
+			return std::nullopt;
+		}
+
+		return Branch{ static_cast<std::uintptr_t>(destination), instruction.info.length };
+	}
+
+	std::string assembly(const void* a_address)
+	{
+		const auto key = reinterpret_cast<std::uintptr_t>(a_address);
+		{
+			std::lock_guard lock(cache_mutex);
+			if (const auto it = cache.find(key); it != cache.end()) {
+				return it->second;
+			}
+		}
+
+		ZydisDisassembledInstruction instruction;
+		std::string result = disassemble(a_address, instruction) ? std::string(instruction.text) : ""s;
+
+		std::lock_guard lock(cache_mutex);
+		return cache.try_emplace(key, std::move(result)).first->second;
+	}
+
+	bool is_return_address(const void* a_address)
+	{
+		const auto key = reinterpret_cast<std::uintptr_t>(a_address);
+		if (key < MAX_CALL_LENGTH) {
+			return false;
+		}
+
+		{
+			std::lock_guard lock(cache_mutex);
+			if (const auto it = call_site_cache.find(key); it != call_site_cache.end()) {
+				return it->second;
+			}
+		}
+
+		const bool result = precedes_call(key, safe_read);
+
+		std::lock_guard lock(cache_mutex);
+		call_site_cache.try_emplace(key, result);
+		return result;
+	}
+
+	void reset_cache() noexcept
+	{
+		std::lock_guard lock(cache_mutex);
+		cache.clear();
+		call_site_cache.clear();
+	}
+}
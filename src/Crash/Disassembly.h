@@ -0,0 +1,116 @@
+#pragma once
+
+#include <Zydis/Zydis.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace Crash::Disassembly
+{
+	// Longest legal x86-64 instruction
+	inline constexpr std::size_t MAX_INSTRUCTION_LENGTH = ZYDIS_MAX_INSTRUCTION_LENGTH;
+
+	// Decode and format the instruction at a_address using this thread's decoder/formatter.
+	// Reads at most MAX_INSTRUCTION_LENGTH bytes and stops at the first unreadable byte.
+	// Returns false if nothing could be read or decoded.
+	[[nodiscard]] bool disassemble(const void* a_address, ZydisDisassembledInstruction& a_instruction) noexcept;
+
+	// Intel syntax text of the instruction at a_address, or an empty string if it can't be decoded.
+	// Results are cached until reset_cache() so frames repeated across crash log sections decode once.
+	[[nodiscard]] std::string assembly(const void* a_address);
+
+	struct Branch
+	{
+		std::uintptr_t target;
+		std::size_t length;  // encoded length of the branch instruction
+	};
+
+	// Destination of a JMP/CALL at a_address: rel8/rel32 forms directly, [rip+disp32] forms by
+	// reading the pointer slot (the usual detour/trampoline encodings). nullopt for anything else.
+	[[nodiscard]] std::optional<Branch> branch_target(const void* a_address) noexcept;
+
+	// Longest CALL encoding that can precede a return address (FF /2 with SIB + disp32)
+	inline constexpr std::size_t MAX_CALL_LENGTH = 7;
+
+	// Total length of an FF /2 (near indirect CALL) encoding given its ModRM and SIB bytes,
+	// or 0 if a_modrm does not encode /2. The SIB byte is ignored when the ModRM has none.
+	[[nodiscard]] constexpr std::size_t indirect_call_length(std::uint8_t a_modrm, std::uint8_t a_sib) noexcept
+	{
+		const auto mod = a_modrm >> 6;
+		const auto reg = (a_modrm >> 3) & 7;
+		const auto rm = a_modrm & 7;
+		if (reg != 2) {
+			return 0;
+		}
+		if (mod == 3) {
+			return 2;  // call reg
+		}
+
+		const bool hasSib = rm == 4;
+		std::size_t length = 2 + (hasSib ? 1 : 0);
+		switch (mod) {
+		case 0:
+			if (rm == 5 || (hasSib && (a_sib & 7) == 5)) {
+				length += 4;  // [rip+disp32] or [index*scale+disp32]
+			}
+			break;
+		case 1:
+			length += 1;
+			break;
+		default:
+			length += 4;
+			break;
+		}
+		return length;
+	}
+
+	// True if the bytes immediately before a candidate return address end with a CALL
+	// (E8 rel32, or FF /2 in any ModRM/SIB/displacement form). a_preceding holds up to
+	// MAX_CALL_LENGTH bytes, the last of which sits directly before the candidate.
+	[[nodiscard]] constexpr bool follows_call(std::span<const std::uint8_t> a_preceding) noexcept
+	{
+		const auto size = a_preceding.size();
+		if (size >= 5 && a_preceding[size - 5] == 0xE8) {
+			return true;
+		}
+
+		for (std::size_t length = 2; length <= std::min(size, MAX_CALL_LENGTH); ++length) {
+			const auto start = size - length;
+			if (a_preceding[start] != 0xFF) {
+				continue;
+			}
+			const auto modrm = a_preceding[start + 1];
+			const auto sib = length >= 3 ? a_preceding[start + 2] : std::uint8_t{ 0 };
+			if (indirect_call_length(modrm, sib) == length) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// True if the bytes read through a_read end with a CALL that returns to a_address.
+	// a_read(const void* src, std::uint8_t* dst, std::size_t max) copies up to max bytes and
+	// returns how many it copied before the first unreadable one. A short read means the bytes
+	// before a_address are not mapped (e.g. a_address starts a page after a guard page), so no
+	// call can precede it.
+	template <class Read>
+	[[nodiscard]] bool precedes_call(std::uintptr_t a_address, Read&& a_read) noexcept
+	{
+		if (a_address < MAX_CALL_LENGTH) {
+			return false;
+		}
+		std::uint8_t bytes[MAX_CALL_LENGTH]{};
+		const auto length = a_read(reinterpret_cast<const void*>(a_address - MAX_CALL_LENGTH), bytes, MAX_CALL_LENGTH);
+		return length == MAX_CALL_LENGTH && follows_call(std::span<const std::uint8_t>(bytes, length));
+	}
+
+	// True if a CALL instruction ends exactly at a_address, i.e. a_address is a real return address.
+	// Guarded read of the preceding bytes; results are cached until reset_cache().
+	[[nodiscard]] bool is_return_address(const void* a_address);
+
+	// Drop cached disassembly and call-site results; call once at the start of each crash log or thread dump
+	void reset_cache() noexcept;
+}
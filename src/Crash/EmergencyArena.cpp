@@ -0,0 +1,156 @@
+#include "Crash/EmergencyArena.h"
+
+#include <Windows.h>
+#include <cstdlib>
+#include <new>
+
+namespace Crash::EmergencyArena
+{
+	namespace
+	{
+		// Precedes every arena block so deallocate() can find the block bounds without a size
+		struct Header
+		{
+			std::size_t begin;  // cursor before this allocation
+			std::size_t end;    // cursor after this allocation
+		};
+		static_assert(sizeof(Header) == __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+		std::byte* base{ nullptr };
+		std::size_t capacity{ 0 };
+
+		std::atomic<std::size_t> cursor{ 0 };
+		std::atomic<std::size_t> peak{ 0 };
+		std::atomic<std::size_t> allocations{ 0 };
+		std::atomic<std::size_t> fallbacks{ 0 };
+
+		Resource arena_resource;
+
+		[[nodiscard]] constexpr std::size_t align_up(std::size_t a_value, std::size_t a_alignment) noexcept
+		{
+			return (a_value + a_alignment - 1) & ~(a_alignment - 1);
+		}
+
+		void raise_peak(std::size_t a_used) noexcept
+		{
+			auto current = peak.load(std::memory_order_relaxed);
+			while (current < a_used && !peak.compare_exchange_weak(current, a_used, std::memory_order_relaxed)) {}
+		}
+
+		[[nodiscard]] void* heap_allocate(std::size_t a_bytes, std::size_t a_alignment)
+		{
+			const auto ptr = a_alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ?
+			                     ::_aligned_malloc(a_bytes ? a_bytes : 1, a_alignment) :
+			                     std::malloc(a_bytes ? a_bytes : 1);
+			if (!ptr) {
+				throw std::bad_alloc();
+			}
+			return ptr;
+		}
+
+		void heap_free(void* a_ptr, std::size_t a_alignment) noexcept
+		{
+			if (a_alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+				::_aligned_free(a_ptr);
+			} else {
+				std::free(a_ptr);
+			}
+		}
+	}
+
+	void* Resource::do_allocate(std::size_t a_bytes, std::size_t a_alignment)
+	{
+		if (const auto ptr = EmergencyArena::allocate(a_bytes, a_alignment)) {
+			return ptr;
+		}
+		fallbacks.fetch_add(1, std::memory_order_relaxed);
+		return heap_allocate(a_bytes, a_alignment);
+	}
+
+	void Resource::do_deallocate(void* a_ptr, std::size_t, std::size_t a_alignment)
+	{
+		if (!EmergencyArena::deallocate(a_ptr)) {
+			heap_free(a_ptr, a_alignment);
+		}
+	}
+
+	bool Resource::do_is_equal(const std::pmr::memory_resource& a_other) const noexcept
+	{
+		return this == std::addressof(a_other);
+	}
+
+	void install(std::size_t a_capacity) noexcept
+	{
+		if (base) {
+			return;
+		}
+		a_capacity = align_up(a_capacity, 64 * 1024);
+		base = static_cast<std::byte*>(::VirtualAlloc(nullptr, a_capacity, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+		if (!base) {
+			logger::warn("Emergency arena: failed to reserve {} MB (error {}), crash logs will use the process heap"sv,
+				a_capacity >> 20, ::GetLastError());
+			return;
+		}
+		capacity = a_capacity;
+		logger::info("Emergency arena: reserved {} MB at 0x{:X}"sv, capacity >> 20, reinterpret_cast<std::uintptr_t>(base));
+	}
+
+	std::pmr::memory_resource* resource() noexcept
+	{
+		return &arena_resource;
+	}
+
+	void* allocate(std::size_t a_bytes, std::size_t a_alignment) noexcept
+	{
+		if (!base) {
+			return nullptr;
+		}
+		a_alignment = std::max(a_alignment, alignof(Header));
+		a_bytes = std::max<std::size_t>(a_bytes, 1);
+
+		auto current = cursor.load(std::memory_order_relaxed);
+		for (;;) {
+			const auto offset = align_up(current + sizeof(Header), a_alignment);
+			if (offset > capacity || a_bytes > capacity - offset) {
+				return nullptr;
+			}
+			const auto next = align_up(offset + a_bytes, alignof(Header));
+			if (cursor.compare_exchange_weak(current, next, std::memory_order_relaxed)) {
+				raise_peak(next);
+				allocations.fetch_add(1, std::memory_order_relaxed);
+				const auto ptr = base + offset;
+				*reinterpret_cast<Header*>(ptr - sizeof(Header)) = { current, next };
+				return ptr;
+			}
+		}
+	}
+
+	bool deallocate(void* a_ptr) noexcept
+	{
+		if (!owns(a_ptr)) {
+			return false;
+		}
+		// Roll back only if this is still the most recent block; otherwise it stays until exit
+		const auto header = *reinterpret_cast<const Header*>(static_cast<std::byte*>(a_ptr) - sizeof(Header));
+		auto expected = header.end;
+		cursor.compare_exchange_strong(expected, header.begin, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool owns(const void* a_ptr) noexcept
+	{
+		const auto ptr = static_cast<const std::byte*>(a_ptr);
+		return base && ptr >= base && ptr < base + capacity;
+	}
+
+	Usage usage() noexcept
+	{
+		return {
+			capacity,
+			cursor.load(std::memory_order_relaxed),
+			peak.load(std::memory_order_relaxed),
+			allocations.load(std::memory_order_relaxed),
+			fallbacks.load(std::memory_order_relaxed)
+		};
+	}
+}
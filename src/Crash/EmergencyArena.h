@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory_resource>
+
+namespace Crash::EmergencyArena
+{
+	inline constexpr std::size_t DEFAULT_CAPACITY = 64 << 20;
+
+	// Bump allocator over a fixed block reserved and committed up front. Freeing the most recent
+	// allocation rolls the cursor back (temporaries are mostly LIFO); anything else is reclaimed
+	// only when the process exits, which is fine for a crash handler that ends in TerminateProcess.
+	// Requests the arena cannot satisfy go to the process heap and are counted as fallbacks.
+	class Resource final : public std::pmr::memory_resource
+	{
+	protected:
+		void* do_allocate(std::size_t a_bytes, std::size_t a_alignment) override;
+		void do_deallocate(void* a_ptr, std::size_t a_bytes, std::size_t a_alignment) override;
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& a_other) const noexcept override;
+	};
+
+	// Reserve and commit the arena; call once from Crash::Install, before any crash can happen
+	void install(std::size_t a_capacity = DEFAULT_CAPACITY) noexcept;
+
+	// The arena as a memory resource. Only containers the crash handler builds with it explicitly
+	// use the arena; the std::pmr default resource is shared with the game and other plugins
+	// through the CRT and is never replaced.
+	[[nodiscard]] std::pmr::memory_resource* resource() noexcept;
+
+	// Raw arena allocation; nullptr if not installed or exhausted
+	[[nodiscard]] void* allocate(std::size_t a_bytes, std::size_t a_alignment) noexcept;
+
+	// Release an arena pointer; false if a_ptr is not owned by the arena
+	bool deallocate(void* a_ptr) noexcept;
+
+	[[nodiscard]] bool owns(const void* a_ptr) noexcept;
+
+	struct Usage
+	{
+		std::size_t capacity{ 0 };
+		std::size_t used{ 0 };
+		std::size_t peak{ 0 };
+		std::size_t allocations{ 0 };
+		std::size_t fallbacks{ 0 };  // served by the process heap because the arena was full or not reserved
+	};
+
+	[[nodiscard]] Usage usage() noexcept;
+}
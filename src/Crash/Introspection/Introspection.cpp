@@ -1,14 +1,22 @@
 #include "Crash/Introspection/Introspection.h"
 
 #include "Crash/Introspection/HeapAnalysis.h"
+#include "Crash/Introspection/SeenObjects.h"
 #include "Crash/Modules/ModuleHandler.h"
+#include "Crash/Modules/UnloadedModules.h"
 #include "Crash/PDB/PdbHandler.h"
+#include "Crash/SafeMemory.h"
+#include "Crash/StackWords.h"
+#include "Crash/StringScan.h"
 #define MAGIC_ENUM_RANGE_MAX 256
 #include <DbgHelp.h>
 #include <SKSE/Logger.h>
 #include <algorithm>
 #include <atomic>
+#include <bitset>
 #include <magic_enum/magic_enum.hpp>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include "RE/B/BSTMessageQueue.h"
@@ -32,7 +40,81 @@
 
 namespace Crash::Introspection::SSE
 {
-	using filter_results = std::vector<std::pair<std::string, std::string>>;
+	// What the type filters append to. Keys are static literals and nesting is a separate depth,
+	// so no filter formats indentation; Record::render() applies it when the line is printed.
+	// Values are moved in, and like everything else allocated while a crash is being logged,
+	// they come from the emergency arena.
+	class FieldBuilder
+	{
+	public:
+		FieldBuilder() = default;
+
+		// Output for one object that must be done by a_stop and nest at most a_maxDepth (0 = any) levels
+		FieldBuilder(std::chrono::steady_clock::time_point a_stop, int a_maxDepth) noexcept :
+			_stop(a_stop),
+			_maxDepth(a_maxDepth)
+		{}
+
+		// Cooperative budget check for filters that walk lists or recurse: true once the object's
+		// time slice (or the crash deadline) is used up, or when a_depth is past the depth budget.
+		// The caller stops adding fields there; the first refusal of each kind leaves a marker so
+		// the log shows the output is partial.
+		[[nodiscard]] bool exhausted(int a_depth) noexcept
+		{
+			try {
+				if (_maxDepth > 0 && a_depth > _maxDepth) {
+					if (!_depthCut) {
+						_depthCut = true;
+						add(_maxDepth, "Truncated"sv, fmt::format("deeper than {} levels"sv, _maxDepth));
+					}
+					return true;
+				}
+				if (_timedOut || std::chrono::steady_clock::now() < _stop) {
+					return _timedOut;
+				}
+				_timedOut = true;
+				add(a_depth, "Truncated"sv, "introspection time budget exceeded"s);
+			} catch (...) {
+			}
+			return true;
+		}
+
+		[[nodiscard]] bool truncated() const noexcept { return _depthCut || _timedOut; }
+
+		// a_key must be a string literal: only the view is stored
+		void add(int a_depth, std::string_view a_key, std::string a_value)
+		{
+			_fields.push_back({ .literal = a_key, .value = std::move(a_value), .depth = static_cast<std::uint8_t>(a_depth) });
+		}
+
+		// For the few keys that embed an index or slot name
+		void add_dynamic(int a_depth, std::string a_key, std::string a_value)
+		{
+			_fields.push_back({ .owned = std::move(a_key), .value = std::move(a_value), .depth = static_cast<std::uint8_t>(a_depth) });
+		}
+
+		// Nest another filter's output a_depth levels deeper
+		void append(FieldBuilder&& a_other, int a_depth)
+		{
+			for (auto& field : a_other._fields) {
+				field.depth = static_cast<std::uint8_t>(field.depth + a_depth);
+				_fields.push_back(std::move(field));
+			}
+		}
+
+		[[nodiscard]] bool empty() const noexcept { return _fields.empty(); }
+		[[nodiscard]] Fields& fields() noexcept { return _fields; }
+		[[nodiscard]] const Fields& fields() const noexcept { return _fields; }
+
+	private:
+		Fields _fields;
+		std::chrono::steady_clock::time_point _stop{ std::chrono::steady_clock::time_point::max() };
+		int _maxDepth{ 0 };
+		bool _depthCut{ false };
+		bool _timedOut{ false };
+	};
+
+	using filter_results = FieldBuilder;
 
 	[[nodiscard]] std::string quoted(std::string_view a_str)
 	{
@@ -130,18 +212,18 @@ namespace Crash::Introspection::SSE
 			filter_results& a_results,
 			const void* a_ptr, int tab_depth = 0) noexcept
 		{
+			// Also nested under other filters: stop once the object's budget is used up
+			if (a_results.exhausted(tab_depth)) {
+				return;
+			}
+
 			const auto form = static_cast<const value_type*>(a_ptr);
 
 			try {
 				const auto file = form->GetDescriptionOwnerFile();
 				const auto filename = file ? file->GetFilename() : ""sv;
 				if (!filename.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}File"sv,
-							"",
-							tab_depth),
-						quoted(filename));
+					a_results.add(tab_depth, "File"sv, quoted(filename));
 			} catch (...) {}
 
 			try {
@@ -155,12 +237,7 @@ namespace Crash::Introspection::SSE
 						                                    fmt::format("{} -> {}"sv,
 																filesString, sourcefile->GetFilename().data());
 					}
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Modified by"sv,
-							"",
-							tab_depth),
-						filesString);
+					a_results.add(tab_depth, "Modified by"sv, filesString);
 				}
 			} catch (...) {}
 
@@ -177,11 +254,7 @@ namespace Crash::Introspection::SSE
 						                 flagName :
 						                 flagString.append(" | "sv).append(flagName);
 				}
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}Flags"sv,
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "Flags"sv,
 					fmt::format(
 						"0x{:08X} {}"sv,
 						formFlags,
@@ -191,32 +264,18 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto name = form->GetName();
 				if (name && name[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Name"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "Name"sv, quoted(name));
 			} catch (...) {}
 
 			try {
 				const auto editorID = form->GetFormEditorID();
 				if (editorID && editorID[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}EditorID"sv,
-							"",
-							tab_depth),
-						quoted(editorID));
+					a_results.add(tab_depth, "EditorID"sv, quoted(editorID));
 			} catch (...) {}
 
 			try {
 				const auto formID = form->GetFormID();
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}FormID"sv,
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "FormID"sv,
 					fmt::format(
 						"0x{:08X}"sv,
 						formID));
@@ -226,11 +285,7 @@ namespace Crash::Introspection::SSE
 				const auto formType = form->GetFormType();
 				const auto formTypeName = magic_enum::enum_name(formType);
 				if (!formTypeName.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}FormType"sv,
-							"",
-							tab_depth),
+					a_results.add(tab_depth, "FormType"sv,
 						fmt::format(
 							"{} ({:02})"sv,
 							formTypeName, std::to_underlying(formType)));
@@ -254,12 +309,7 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto name = object->GetFullName();
 				if (name && name[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}GetFullName"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "GetFullName"sv, quoted(name));
 			} catch (...) {}
 		}
 	};
@@ -280,24 +330,14 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto owner = object->owner.get().get();
 				if (owner) {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Owner"sv,
-							"",
-							tab_depth),
-						"---");
+					a_results.add(tab_depth, "Owner"sv, "---");
 					TESForm<RE::Actor>::filter(a_results, owner, tab_depth + 1);
 				}
 			} catch (...) {}
 			try {
 				const auto target = object->target.get().get();
 				if (target) {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Target"sv,
-							"",
-							tab_depth),
-						"---");
+					a_results.add(tab_depth, "Target"sv, "---");
 					TESForm<RE::Actor>::filter(a_results, target, tab_depth + 1);
 				}
 			} catch (...) {}
@@ -317,11 +357,7 @@ namespace Crash::Introspection::SSE
 
 			try {
 				const auto formFlags = form->flags;
-				a_results.emplace_back(
-					fmt::format(fmt::runtime(
-									"{:\t>{}}Flags"sv),
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "Flags"sv,
 					fmt::format(fmt::runtime(
 									"0x{:08X}"sv),
 						(std::uint64_t)formFlags.get()));
@@ -329,32 +365,18 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto name = form->name.c_str();
 				if (name && name[0])
-					a_results.emplace_back(
-						fmt::format(fmt::runtime(
-										"{:\t>{}}Name"sv),
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "Name"sv, quoted(name));
 			} catch (...) {}
 			try {
 				const auto rttiname = form->GetRTTI() ? form->GetRTTI()->GetName() : ""sv;
 				if (!rttiname.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}RTTIName"sv,
-							"",
-							tab_depth),
-						quoted(rttiname));
+					a_results.add(tab_depth, "RTTIName"sv, quoted(rttiname));
 			} catch (...) {}
 			try {
 				const auto formType = form->GetType();
 				const auto formTypeName = magic_enum::enum_name(formType);
 				if (!formTypeName.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}NiPropertyType"sv,
-							"",
-							tab_depth),
+					a_results.add(tab_depth, "NiPropertyType"sv,
 						fmt::format(
 							"{} ({:02})"sv,
 							formTypeName,
@@ -366,13 +388,7 @@ namespace Crash::Introspection::SSE
 					if (!extraData->GetName().empty()) {
 						const auto name = extraData->GetName().c_str();
 						if (name && name[0])
-							a_results.emplace_back(
-								fmt::format(
-									"{:\t>{}}ExtraData[{}] Name"sv,
-									"",
-									tab_depth,
-									i),
-								quoted(name));
+							a_results.add_dynamic(tab_depth, fmt::format("ExtraData[{}] Name"sv, i), quoted(name));
 					}
 				}
 			} catch (...) {}
@@ -390,6 +406,11 @@ namespace Crash::Introspection::SSE
 			filter_results& a_results,
 			const void* a_ptr, int tab_depth = 0) noexcept
 		{
+			// Also nested under other filters: stop once the object's budget is used up
+			if (a_results.exhausted(tab_depth)) {
+				return;
+			}
+
 			const auto ref = static_cast<const value_type*>(a_ptr);
 
 			try {
@@ -399,49 +420,21 @@ namespace Crash::Introspection::SSE
 					TESForm<RE::TESForm>::filter(xResults, objRef);
 
 					if (!xResults.empty()) {
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}Object Reference"sv,
-								"",
-								tab_depth),
-							"");
-						for (auto& [key, value] : xResults) {
-							a_results.emplace_back(
-								fmt::format(
-									"{:\t>{}}{}"sv,
-									"",
-									tab_depth,
-									key),
-								std::move(value));
-						}
+						a_results.add(tab_depth, "Object Reference"sv, "");
+						a_results.append(std::move(xResults), tab_depth);
 					}
 				} else {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Object Reference"sv,
-							"",
-							tab_depth),
-						"None");
+					a_results.add(tab_depth, "Object Reference"sv, "None");
 				}
 			} catch (...) {}
 
 			try {
 				const auto parentCell = ref->GetParentCell();
 				if (parentCell) {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}ParentCell"sv,
-							"",
-							tab_depth),
-						"---");
+					a_results.add(tab_depth, "ParentCell"sv, "---");
 					TESForm<RE::TESObjectCELL>::filter(a_results, parentCell, tab_depth + 1);
 				} else {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}ParentCell"sv,
-							"",
-							tab_depth),
-						"None");
+					a_results.add(tab_depth, "ParentCell"sv, "None");
 				}
 			} catch (...) {}
 		}
@@ -462,23 +455,13 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto name = object ? object->name.c_str() : ""sv;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Name"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "Name"sv, quoted(name));
 			} catch (...) {}
 
 			try {
 				const auto name = object->GetRTTI() ? object->GetRTTI()->GetName() : ""sv;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}RTTIName"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "RTTIName"sv, quoted(name));
 			} catch (...) {}
 
 			try {
@@ -487,13 +470,7 @@ namespace Crash::Introspection::SSE
 					if (!extraData->GetName().empty()) {
 						const auto name = extraData->GetName().c_str();
 						if (name && name[0])
-							a_results.emplace_back(
-								fmt::format(
-									"{:\t>{}}ExtraData[{}] Name"sv,
-									"",
-									tab_depth,
-									i),
-								quoted(name));
+							a_results.add_dynamic(tab_depth, fmt::format("ExtraData[{}] Name"sv, i), quoted(name));
 					}
 				}
 			} catch (...) {}
@@ -510,11 +487,7 @@ namespace Crash::Introspection::SSE
 						                 flagName :
 						                 flagString.append(" | "sv).append(flagName);
 				}
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}Flags"sv,
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "Flags"sv,
 					fmt::format(
 						"{}"sv,
 						flagString));
@@ -524,37 +497,17 @@ namespace Crash::Introspection::SSE
 				const auto userdata = object->GetUserData();
 				if (userdata) {
 					const auto name = userdata->GetDisplayFullName();
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Full Name"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "Full Name"sv, quoted(name));
 					const auto objectref = userdata->GetObjectReference();
 					const auto filename = objectref && objectref->As<RE::TESModel>() ? objectref->As<RE::TESModel>()->GetModel() :
 					                                                                   ""sv;
 					if (!filename.empty())
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}File"sv,
-								"",
-								tab_depth),
-							quoted(filename));
+						a_results.add(tab_depth, "File"sv, quoted(filename));
 					if (auto owner = userdata->GetOwner()) {
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}Checking Owner"sv,
-								"",
-								tab_depth),
-							"-----"sv);
+						a_results.add(tab_depth, "Checking Owner"sv, "-----");
 						TESForm<RE::TESForm>::filter(a_results, owner, tab_depth + 1);
 					}
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Checking User Data"sv,
-							"",
-							tab_depth),
-						"-----"sv);
+					a_results.add(tab_depth, "Checking User Data"sv, "-----");
 					TESObjectREFR::filter(a_results, userdata, tab_depth + 1);
 				}
 			} catch (...) {}
@@ -564,18 +517,8 @@ namespace Crash::Introspection::SSE
 					const auto objectref = objectRefr->GetObjectReference();
 					const auto filename = objectref && objectref->As<RE::TESModel>() ? objectref->As<RE::TESModel>()->GetModel() : ""sv;
 					if (!filename.empty())
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}File"sv,
-								"",
-								tab_depth),
-							quoted(filename));
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Checking TESObjectREFR"sv,
-							"",
-							tab_depth),
-						"{}"sv);
+						a_results.add(tab_depth, "File"sv, quoted(filename));
+					a_results.add(tab_depth, "Checking TESObjectREFR"sv, "{}");
 					TESObjectREFR::filter(a_results, objectRefr, tab_depth + 1);
 				}
 			} catch (...) {}
@@ -612,13 +555,7 @@ namespace Crash::Introspection::SSE
 												exists = false;
 											}
 
-											a_results.emplace_back(
-												fmt::format(
-													"{:\t>{}}Texture[{}]"sv,
-													"",
-													tab_depth,
-													slot_names[i]),
-												exists ? quoted(tex_path) : fmt::format("[MISSING] {}"sv, tex_path));
+											a_results.add_dynamic(tab_depth, fmt::format("Texture[{}]"sv, slot_names[i]), exists ? quoted(tex_path) : fmt::format("[MISSING] {}"sv, tex_path));
 										}
 									}
 								}
@@ -640,12 +577,7 @@ namespace Crash::Introspection::SSE
 									} catch (...) {
 										exists = false;
 									}
-									a_results.emplace_back(
-										fmt::format(
-											"{:\t>{}}EffectTexture[Source]"sv,
-											"",
-											tab_depth),
-										exists ? quoted(source_tex) : fmt::format("[MISSING] {}"sv, source_tex));
+									a_results.add(tab_depth, "EffectTexture[Source]"sv, exists ? quoted(source_tex) : fmt::format("[MISSING] {}"sv, source_tex));
 								}
 
 								// Greyscale texture
@@ -658,12 +590,7 @@ namespace Crash::Introspection::SSE
 									} catch (...) {
 										exists = false;
 									}
-									a_results.emplace_back(
-										fmt::format(
-											"{:\t>{}}EffectTexture[Greyscale]"sv,
-											"",
-											tab_depth),
-										exists ? quoted(grey_tex) : fmt::format("[MISSING] {}"sv, grey_tex));
+									a_results.add(tab_depth, "EffectTexture[Greyscale]"sv, exists ? quoted(grey_tex) : fmt::format("[MISSING] {}"sv, grey_tex));
 								}
 							}
 						}
@@ -675,11 +602,7 @@ namespace Crash::Introspection::SSE
 				const auto parent = object->parent;
 				const auto parentIndex = object->parentIndex;
 				if (parent) {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Checking Parent"sv,
-							"",
-							tab_depth),
+					a_results.add(tab_depth, "Checking Parent"sv,
 						fmt::format(
 							"{}"sv, parentIndex));
 					filter(a_results, parent, tab_depth + 1);
@@ -703,23 +626,13 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto name = object ? object->name.c_str() : ""sv;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Name"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "Name"sv, quoted(name));
 			} catch (...) {}
 
 			try {
 				const auto name = object->GetRTTI() ? object->GetRTTI()->GetName() : ""sv;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}RTTIName"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "RTTIName"sv, quoted(name));
 			} catch (...) {}
 		}
 	};
@@ -738,11 +651,7 @@ namespace Crash::Introspection::SSE
 				return;
 			try {
 				const auto& header = object->header;
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}Header"sv,
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "Header"sv,
 					fmt::format(
 						"author: {} version: {} processScript: {} exportScript: {}",
 						header.author,
@@ -754,34 +663,19 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto lastLoadedRTTI = object->lastLoadedRTTI;
 				if (lastLoadedRTTI && lastLoadedRTTI[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}lastLoadedRTTI"sv,
-							"",
-							tab_depth),
-						quoted(lastLoadedRTTI));
+					a_results.add(tab_depth, "lastLoadedRTTI"sv, quoted(lastLoadedRTTI));
 			} catch (...) {}
 
 			try {
 				const auto inputFilePath = object->inputFilePath;
 				if (inputFilePath && inputFilePath[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}inputFilePath"sv,
-							"",
-							tab_depth),
-						quoted(inputFilePath));
+					a_results.add(tab_depth, "inputFilePath"sv, quoted(inputFilePath));
 			} catch (...) {}
 
 			try {
 				const auto filePath = object->filePath;
 				if (filePath && filePath[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}filePath"sv,
-							"",
-							tab_depth),
-						quoted(filePath));
+					a_results.add(tab_depth, "filePath"sv, quoted(filePath));
 			} catch (...) {}
 
 			// If filePath/inputFilePath are empty (e.g. NIF loaded from a BSA into a memory
@@ -799,9 +693,7 @@ namespace Crash::Introspection::SSE
 							RE::BSFixedString resName;
 							stream->DoGetName(resName);
 							if (!resName.empty()) {
-								a_results.emplace_back(
-									fmt::format("{:\t>{}}streamName"sv, "", tab_depth),
-									quoted(resName.c_str()));
+								a_results.add(tab_depth, "streamName"sv, quoted(resName.c_str()));
 							}
 						}
 					}
@@ -828,9 +720,7 @@ namespace Crash::Introspection::SSE
 					RE::BSFixedString resName;
 					stream->DoGetName(resName);
 					if (!resName.empty()) {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}streamName"sv, "", tab_depth),
-							quoted(resName.c_str()));
+						a_results.add(tab_depth, "streamName"sv, quoted(resName.c_str()));
 					}
 				}
 			} catch (...) {}
@@ -838,9 +728,7 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto err = static_cast<std::uint32_t>(object->lastError);
 				if (err != 0) {
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}lastError"sv, "", tab_depth),
-						fmt::format("{:#x}"sv, err));
+					a_results.add(tab_depth, "lastError"sv, fmt::format("{:#x}"sv, err));
 				}
 			} catch (...) {}
 		}
@@ -860,12 +748,10 @@ namespace Crash::Introspection::SSE
 				return;
 			try {
 				const auto count = object->numPartitions;
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}NumPartitions"sv, "", tab_depth),
-					fmt::format("{}"sv, count));
+				a_results.add(tab_depth, "NumPartitions"sv, fmt::format("{}"sv, count));
 				const auto parts = object->partitions.data();
 				if (parts && count > 0 && count <= 64) {
-					for (std::uint32_t i = 0; i < count; ++i) {
+					for (std::uint32_t i = 0; i < count && !a_results.exhausted(tab_depth); ++i) {
 						const auto buffData = parts[i].buffData;
 						if (buffData) {
 							const auto fmt_buf = [](const void* ptr) -> std::string {
@@ -880,19 +766,13 @@ namespace Crash::Introspection::SSE
 								return fmt::format("0x{:016X}"sv, reinterpret_cast<std::uintptr_t>(ptr));
 							};
 							try {
-								a_results.emplace_back(
-									fmt::format("{:\t>{}}Partition[{}] RefCount"sv, "", tab_depth, i),
-									fmt::format("{}"sv, buffData->refCount));
+								a_results.add_dynamic(tab_depth, fmt::format("Partition[{}] RefCount"sv, i), fmt::format("{}"sv, buffData->refCount));
 							} catch (...) {}
 							try {
-								a_results.emplace_back(
-									fmt::format("{:\t>{}}Partition[{}] VertexBuffer"sv, "", tab_depth, i),
-									fmt_buf(buffData->vertexBuffer));
+								a_results.add_dynamic(tab_depth, fmt::format("Partition[{}] VertexBuffer"sv, i), fmt_buf(buffData->vertexBuffer));
 							} catch (...) {}
 							try {
-								a_results.emplace_back(
-									fmt::format("{:\t>{}}Partition[{}] IndexBuffer"sv, "", tab_depth, i),
-									fmt_buf(buffData->indexBuffer));
+								a_results.add_dynamic(tab_depth, fmt::format("Partition[{}] IndexBuffer"sv, i), fmt_buf(buffData->indexBuffer));
 							} catch (...) {}
 						}
 					}
@@ -921,15 +801,11 @@ namespace Crash::Introspection::SSE
 						if (auto heap = Heap::analyze_heap_pointer(partition); heap)
 							info += fmt::format(" [Heap: {}]"sv, Heap::format_heap_info(*heap));
 					} catch (...) {}
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}SkinPartition"sv, "", tab_depth),
-						std::move(info));
+					a_results.add(tab_depth, "SkinPartition"sv, std::move(info));
 				}
 			} catch (...) {}
 			try {
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}NumBones"sv, "", tab_depth),
-					fmt::format("{}"sv, object->numMatrices));
+				a_results.add(tab_depth, "NumBones"sv, fmt::format("{}"sv, object->numMatrices));
 			} catch (...) {}
 			try {
 				const auto bones = object->bones;
@@ -939,9 +815,7 @@ namespace Crash::Introspection::SSE
 						if (auto heap = Heap::analyze_heap_pointer(bones); heap)
 							info += fmt::format(" [Heap: {}]"sv, Heap::format_heap_info(*heap));
 					} catch (...) {}
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Bones"sv, "", tab_depth),
-						std::move(info));
+					a_results.add(tab_depth, "Bones"sv, std::move(info));
 				}
 			} catch (...) {}
 		}
@@ -962,12 +836,7 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto& filename = object->fxpFilename;
 				if (filename && filename[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}fxpFilename"sv,
-							"",
-							tab_depth),
-						quoted(filename));
+					a_results.add(tab_depth, "fxpFilename"sv, quoted(filename));
 			} catch (...) {}
 
 			try {
@@ -983,11 +852,7 @@ namespace Crash::Introspection::SSE
 					break;
 				}
 
-				a_results.emplace_back(
-					fmt::format(fmt::runtime(
-									"{:\t>{}}ShaderType"),
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "ShaderType"sv,
 					fmt::format(fmt::runtime(
 									"0x{:08X}"),
 						typeString));
@@ -1011,24 +876,14 @@ namespace Crash::Introspection::SSE
 				const auto& feature = object->GetFeature();
 				const auto featureName = magic_enum::enum_name(feature);
 				if (!featureName.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Feature"sv,
-							"",
-							tab_depth),
-						featureName);
+					a_results.add(tab_depth, "Feature"sv, std::string(featureName));
 			} catch (...) {}
 
 			try {
 				const auto type = object->GetType();
 				const auto typeName = magic_enum::enum_name(type);
 				if (!typeName.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Type"sv,
-							"",
-							tab_depth),
-						quoted(typeName));
+					a_results.add(tab_depth, "Type"sv, quoted(typeName));
 			} catch (...) {}
 		}
 	};
@@ -1042,18 +897,18 @@ namespace Crash::Introspection::SSE
 			filter_results& a_results,
 			const void* a_ptr, int tab_depth = 0) noexcept
 		{
+			// Also nested under other filters: stop once the object's budget is used up
+			if (a_results.exhausted(tab_depth)) {
+				return;
+			}
+
 			const auto object = static_cast<const value_type*>(a_ptr);
 			if (!object)
 				return;
 			try {
 				const auto& name = object->originalSkeletonName;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Skeleton Name"sv,
-							"",
-							tab_depth),
-						quoted(name.data()));
+					a_results.add(tab_depth, "Skeleton Name"sv, quoted(name.data()));
 			} catch (...) {}
 		};
 	};
@@ -1067,18 +922,18 @@ namespace Crash::Introspection::SSE
 			filter_results& a_results,
 			const void* a_ptr, int tab_depth = 0) noexcept
 		{
+			// Also nested under other filters: stop once the object's budget is used up
+			if (a_results.exhausted(tab_depth)) {
+				return;
+			}
+
 			const auto object = static_cast<const value_type*>(a_ptr);
 			if (!object)
 				return;
 			try {
 				const auto& name = object->name;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Name"sv,
-							"",
-							tab_depth),
-						quoted(name.c_str()));
+					a_results.add(tab_depth, "Name"sv, quoted(name.c_str()));
 			} catch (...) {}
 		};
 	};
@@ -1098,12 +953,7 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto& name = object->animationName;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Animation Name"sv,
-							"",
-							tab_depth),
-						quoted(name.data()));
+					a_results.add(tab_depth, "Animation Name"sv, quoted(name.data()));
 			} catch (...) {}
 			try {
 				const auto flags = object->mode;
@@ -1117,11 +967,7 @@ namespace Crash::Introspection::SSE
 						flagString = flagName;
 					break;
 				}
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}Playback Mode"sv,
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "Playback Mode"sv,
 					fmt::format(
 						"{} {}"sv,
 						flags.underlying(),
@@ -1130,12 +976,7 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto& binding = object->binding;
 				if (binding) {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Checking Binding"sv,
-							"",
-							tab_depth),
-						"-----"sv);
+					a_results.add(tab_depth, "Checking Binding"sv, "-----");
 					hkaAnimationBinding::filter(a_results, binding, tab_depth + 1);
 				}
 			} catch (...) {}
@@ -1160,27 +1001,11 @@ namespace Crash::Introspection::SSE
 					for (int i = 0; i < 2; i++) {
 						auto entity = entities[i];
 						if (entity) {
-							a_results.emplace_back(
-								fmt::format(
-									"{:\t>{}}Entity [{}]"sv,
-									"",
-									tab_depth,
-									i),
-								"-----"sv);
+							a_results.add_dynamic(tab_depth, fmt::format("Entity [{}]"sv, i), "-----");
 							if (!entity->name.empty())
-								a_results.emplace_back(
-									fmt::format(
-										"{:\t>{}}Name"sv,
-										"",
-										tab_depth),
-									quoted(entity->name.data()));
+								a_results.add(tab_depth, "Name"sv, quoted(entity->name.data()));
 							if (entity->GetUserData()) {
-								a_results.emplace_back(
-									fmt::format(
-										"{:\t>{}}Checking User Data"sv,
-										"",
-										tab_depth),
-									"-----"sv);
+								a_results.add(tab_depth, "Checking User Data"sv, "-----");
 								TESObjectREFR::filter(a_results, entity->GetUserData(), tab_depth + 1);
 							}
 						}
@@ -1204,20 +1029,11 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto& name = object->name;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Name"sv,
-							"",
-							tab_depth),
-						quoted(name.data()));
+					a_results.add(tab_depth, "Name"sv, quoted(name.data()));
 			} catch (...) {}
 			try {
 				const auto& id = object->id;
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}ID"sv,
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "ID"sv,
 					fmt::format(
 						"0x{:08X}"sv,
 						id));
@@ -1240,47 +1056,22 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto& name = object->name;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Name"sv,
-							"",
-							tab_depth),
-						quoted(name.data()));
+					a_results.add(tab_depth, "Name"sv, quoted(name.data()));
 			} catch (...) {}
 			try {
 				const auto userdata = object->GetUserData();
 				if (userdata) {
 					const auto name = userdata->GetDisplayFullName();
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Full Name"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "Full Name"sv, quoted(name));
 					const auto objectref = userdata->GetObjectReference();
 					const auto filename = objectref && objectref->As<RE::TESModel>() ? objectref->As<RE::TESModel>()->GetModel() :
 					                                                                   ""sv;
 					if (!filename.empty())
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}File"sv,
-								"",
-								tab_depth),
-							quoted(filename));
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Checking User Data"sv,
-							"",
-							tab_depth),
-						"-----"sv);
+						a_results.add(tab_depth, "File"sv, quoted(filename));
+					a_results.add(tab_depth, "Checking User Data"sv, "-----");
 					TESObjectREFR::filter(a_results, userdata, tab_depth + 1);
 					if (auto owner = userdata->GetOwner()) {
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}Checking Owner"sv,
-								"",
-								tab_depth),
-							"-----"sv);
+						a_results.add(tab_depth, "Checking Owner"sv, "-----");
 						TESForm<RE::TESForm>::filter(a_results, owner, tab_depth + 1);
 					}
 				}
@@ -1303,12 +1094,7 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto& name = object->projectName;
 				if (!name.empty())
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Project Name"sv,
-							"",
-							tab_depth),
-						quoted(name.data()));
+					a_results.add(tab_depth, "Project Name"sv, quoted(name.data()));
 			} catch (...) {}
 			try {
 				auto characterInstance = &(object->characterInstance);
@@ -1318,12 +1104,7 @@ namespace Crash::Introspection::SSE
 			try {
 				auto& holder = object->holder;
 				if (holder) {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Holder"sv,
-							""sv,
-							tab_depth),
-						""sv);
+					a_results.add(tab_depth, "Holder"sv, "");
 					TESObjectREFR::filter(a_results, holder, tab_depth + 1);
 				}
 			} catch (...) {}
@@ -1348,34 +1129,19 @@ namespace Crash::Introspection::SSE
 				try {
 					const auto dirName = stream->dirName.c_str();
 					if (dirName && dirName[0])
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}Directory Name"sv,
-								"",
-								tab_depth),
-							quoted(dirName));
+						a_results.add(tab_depth, "Directory Name"sv, quoted(dirName));
 				} catch (...) {}
 
 				try {
 					const auto fileName = stream->fileName.c_str();
 					if (fileName && fileName[0])
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}File Name"sv,
-								"",
-								tab_depth),
-							quoted(fileName));
+						a_results.add(tab_depth, "File Name"sv, quoted(fileName));
 				} catch (...) {}
 
 				try {
 					const auto prefix = stream->prefix.c_str();
 					if (prefix && prefix[0])
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}Prefix"sv,
-								"",
-								tab_depth),
-							quoted(prefix));
+						a_results.add(tab_depth, "Prefix"sv, quoted(prefix));
 				} catch (...) {}
 			}
 		};
@@ -1400,30 +1166,15 @@ namespace Crash::Introspection::SSE
 						const std::string_view name = function->GetName();
 						const std::string_view objName = function->GetObjectTypeName();
 						if (!name.empty() && !objName.empty())
-							a_results.emplace_back(
-								fmt::format(
-									"{:\t>{}}Function"sv,
-									"",
-									tab_depth),
-								fmt::format("\"{}.{}\""sv, objName, name));
+							a_results.add(tab_depth, "Function"sv, fmt::format("\"{}.{}\""sv, objName, name));
 						else if (!name.empty())
-							a_results.emplace_back(
-								fmt::format(
-									"{:\t>{}}Function"sv,
-									"",
-									tab_depth),
-								quoted(name));
+							a_results.add(tab_depth, "Function"sv, quoted(name));
 					} catch (...) {}
 
 					try {
 						const std::string_view stateName = function->GetStateName();
 						if (!stateName.empty())
-							a_results.emplace_back(
-								fmt::format(
-									"{:\t>{}}State"sv,
-									"",
-									tab_depth),
-								quoted(stateName));
+							a_results.add(tab_depth, "State"sv, quoted(stateName));
 
 					} catch (...) {}
 				}
@@ -1444,23 +1195,13 @@ namespace Crash::Introspection::SSE
 				try {
 					const std::string_view name = info->name;
 					if (!name.empty())
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}Name"sv,
-								"",
-								tab_depth),
-							quoted(name));
+						a_results.add(tab_depth, "Name"sv, quoted(name));
 				} catch (...) {}
 
 				try {
 					const std::string_view docString = info->docString;
 					if (!docString.empty())
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}DocString"sv,
-								"",
-								tab_depth),
-							quoted(docString));
+						a_results.add(tab_depth, "DocString"sv, quoted(docString));
 				} catch (...) {}
 			}
 		};
@@ -1482,34 +1223,26 @@ namespace Crash::Introspection::SSE
 				try {
 					const auto minPageSize = object->minPageSize;
 					const auto maxPageSize = object->maxPageSize;
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Page Sizes", "", tab_depth),
-						fmt::format("{} - {} bytes", minPageSize, maxPageSize));
+					a_results.add(tab_depth, "Page Sizes"sv, fmt::format("{} - {} bytes", minPageSize, maxPageSize));
 				} catch (...) {}
 
 				try {
 					const auto maxAllocatedMemory = object->maxAllocatedMemory;
 					const auto ignoreMemoryLimit = object->ignoreMemoryLimit;
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Memory Limit", "", tab_depth),
-						fmt::format("{} bytes (Ignored: {})", maxAllocatedMemory, ignoreMemoryLimit));
+					a_results.add(tab_depth, "Memory Limit"sv, fmt::format("{} bytes (Ignored: {})", maxAllocatedMemory, ignoreMemoryLimit));
 				} catch (...) {}
 
 				try {
 					const auto currentMemorySize = object->currentMemorySize;
 					const auto maxAllocatedMemory = object->maxAllocatedMemory;
 					const auto percentage = maxAllocatedMemory > 0 ? (static_cast<double>(currentMemorySize) / maxAllocatedMemory) * 100.0 : 0.0;
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Current Usage", "", tab_depth),
-						fmt::format("{} / {} bytes ({:.2f}%)", currentMemorySize, maxAllocatedMemory, percentage));
+					a_results.add(tab_depth, "Current Usage"sv, fmt::format("{} / {} bytes ({:.2f}%)", currentMemorySize, maxAllocatedMemory, percentage));
 				} catch (...) {}
 
 				try {
 					const auto maxAdditionalAllocations = object->maxAdditionalAllocations;
 					if (maxAdditionalAllocations > 0) {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Max Additional Allocations", "", tab_depth),
-							fmt::format("{}", maxAdditionalAllocations));
+						a_results.add(tab_depth, "Max Additional Allocations"sv, fmt::format("{}", maxAdditionalAllocations));
 					}
 				} catch (...) {}
 			}
@@ -1532,20 +1265,14 @@ namespace Crash::Introspection::SSE
 					}
 
 					try {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Type"sv, "", tab_depth),
-							fmt::format("{}"sv, magic_enum::enum_name(message->type)));
+						a_results.add(tab_depth, "Type"sv, fmt::format("{}"sv, magic_enum::enum_name(message->type)));
 					} catch (...) {}
 
 					try {
 						if (message->stack) {
 							const auto stack = message->stack.get();
-							a_results.emplace_back(
-								fmt::format("{:\t>{}}Stack ID"sv, "", tab_depth),
-								fmt::format("{}"sv, stack->stackID));
-							a_results.emplace_back(
-								fmt::format("{:\t>{}}Stack State"sv, "", tab_depth),
-								fmt::format("{}"sv, magic_enum::enum_name(stack->state.get())));
+							a_results.add(tab_depth, "Stack ID"sv, fmt::format("{}"sv, stack->stackID));
+							a_results.add(tab_depth, "Stack State"sv, fmt::format("{}"sv, magic_enum::enum_name(stack->state.get())));
 						}
 					} catch (...) {}
 
@@ -1558,20 +1285,14 @@ namespace Crash::Introspection::SSE
 							RE::BSScript::Variable self;
 							RE::BSScrapArray<RE::BSScript::Variable> args;
 							if (message->funcQuery->GetFunctionCallInfo(callType, objectType, functionName, self, args)) {
-								a_results.emplace_back(
-									fmt::format("{:\t>{}}Call Type"sv, "", tab_depth),
-									fmt::format("{}"sv, magic_enum::enum_name(callType)));
+								a_results.add(tab_depth, "Call Type"sv, fmt::format("{}"sv, magic_enum::enum_name(callType)));
 
 								if (objectType && objectType->GetName()) {
-									a_results.emplace_back(
-										fmt::format("{:\t>{}}Object"sv, "", tab_depth),
-										quoted(objectType->GetName()));
+									a_results.add(tab_depth, "Object"sv, quoted(objectType->GetName()));
 								}
 
 								if (functionName.c_str() && functionName[0]) {
-									a_results.emplace_back(
-										fmt::format("{:\t>{}}Function"sv, "", tab_depth),
-										quoted(functionName.c_str()));
+									a_results.add(tab_depth, "Function"sv, quoted(functionName.c_str()));
 								}
 
 								std::string argsString;
@@ -1588,16 +1309,12 @@ namespace Crash::Introspection::SSE
 									argsString += fmt::format(", ... (+{})"sv, argsCount - MAX_ARGS);
 								}
 								if (!argsString.empty()) {
-									a_results.emplace_back(
-										fmt::format("{:\t>{}}Args"sv, "", tab_depth),
-										argsString);
+									a_results.add(tab_depth, "Args"sv, argsString);
 								}
 
 								const auto selfString = format_script_variable(self, skyrimVm);
 								if (!selfString.empty() && selfString != "None"s) {
-									a_results.emplace_back(
-										fmt::format("{:\t>{}}Self"sv, "", tab_depth),
-										selfString);
+									a_results.add(tab_depth, "Self"sv, selfString);
 								}
 							}
 						}
@@ -1615,11 +1332,11 @@ namespace Crash::Introspection::SSE
 				}
 
 				std::string result;
-				for (const auto& [key, value] : details) {
+				for (const auto& field : details.fields()) {
 					if (!result.empty()) {
 						result += ", "s;
 					}
-					result += key + "="s + value;
+					result += fmt::format("{:\t>{}}{}={}"sv, "", field.depth, field.key(), field.value);
 				}
 				return result;
 			}
@@ -1677,34 +1394,24 @@ namespace Crash::Introspection::SSE
 						return;
 
 					try {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Overstressed", "", tab_depth),
-							fmt::format("{}", object->overstressed));
+						a_results.add(tab_depth, "Overstressed"sv, fmt::format("{}", object->overstressed));
 					} catch (...) {}
 
 					try {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Initialized", "", tab_depth),
-							fmt::format("{}", object->initialized));
+						a_results.add(tab_depth, "Initialized"sv, fmt::format("{}", object->initialized));
 					} catch (...) {}
 
 					try {
 						const auto freezeState = object->freezeState;
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Freeze State", "", tab_depth),
-							fmt::format("{}", magic_enum::enum_name(freezeState.get())));
+						a_results.add(tab_depth, "Freeze State"sv, fmt::format("{}", magic_enum::enum_name(freezeState.get())));
 					} catch (...) {}
 
 					try {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Frozen Stacks Count", "", tab_depth),
-							fmt::format("{}", object->frozenStacksCount));
+						a_results.add(tab_depth, "Frozen Stacks Count"sv, fmt::format("{}", object->frozenStacksCount));
 					} catch (...) {}
 
 					try {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Waiting Function Messages", "", tab_depth),
-							fmt::format("{}", object->uiWaitingFunctionMessages));
+						a_results.add(tab_depth, "Waiting Function Messages"sv, fmt::format("{}", object->uiWaitingFunctionMessages));
 					} catch (...) {}
 
 					try {
@@ -1714,28 +1421,20 @@ namespace Crash::Introspection::SSE
 							if (object->uiWaitingFunctionMessages > MAX_MESSAGES) {
 								messageSummary += fmt::format("{:\t>{}}... ({} more)\n"sv, "", tab_depth, object->uiWaitingFunctionMessages - MAX_MESSAGES);
 							}
-							a_results.emplace_back(
-								fmt::format("{:\t>{}}Queued Function Messages"sv, "", tab_depth),
-								messageSummary);
+							a_results.add(tab_depth, "Queued Function Messages"sv, messageSummary);
 						}
 					} catch (...) {}
 
 					try {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Object Table Size", "", tab_depth),
-							fmt::format("{}", object->objectTable.size()));
+						a_results.add(tab_depth, "Object Table Size"sv, fmt::format("{}", object->objectTable.size()));
 					} catch (...) {}
 
 					try {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Array Table Size", "", tab_depth),
-							fmt::format("{}", object->arrays.size()));
+						a_results.add(tab_depth, "Array Table Size"sv, fmt::format("{}", object->arrays.size()));
 					} catch (...) {}
 
 					try {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Running Stacks Count", "", tab_depth),
-							fmt::format("{}", object->allRunningStacks.size()));
+						a_results.add(tab_depth, "Running Stacks Count"sv, fmt::format("{}", object->allRunningStacks.size()));
 					} catch (...) {}
 				}
 			};
@@ -1757,26 +1456,18 @@ namespace Crash::Introspection::SSE
 					try {
 						// Add queue metadata
 						try {
-							a_results.emplace_back(
-								fmt::format("{:\t>{}}Head"sv, "", tab_depth),
-								fmt::format("0x{:X}"sv, reinterpret_cast<std::uintptr_t>(queue->head)));
+							a_results.add(tab_depth, "Head"sv, fmt::format("0x{:X}"sv, reinterpret_cast<std::uintptr_t>(queue->head)));
 						} catch (...) {}
 
 						constexpr std::size_t MAX_MESSAGES = 5;
 						auto messageSummary = format_function_message_queue(queue->head, MAX_MESSAGES, tab_depth);
 						if (!messageSummary.empty() && messageSummary != "\n"s) {
-							a_results.emplace_back(
-								fmt::format("{:\t>{}}Queued Messages"sv, "", tab_depth),
-								messageSummary);
+							a_results.add(tab_depth, "Queued Messages"sv, messageSummary);
 						} else {
-							a_results.emplace_back(
-								fmt::format("{:\t>{}}Queue Status"sv, "", tab_depth),
-								"Empty"s);
+							a_results.add(tab_depth, "Queue Status"sv, "Empty"s);
 						}
 					} catch (...) {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Queue Error"sv, "", tab_depth),
-							"<failed to read queue>"s);
+						a_results.add(tab_depth, "Queue Error"sv, "<failed to read queue>"s);
 					}
 				}
 			};
@@ -1797,12 +1488,7 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto name = object->name.c_str();
 				if (name && name[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Name"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "Name"sv, quoted(name));
 			} catch (...) {}
 		};
 	};
@@ -1822,22 +1508,13 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto name = object->music ? object->music->GetName() : "";
 				if (name && name[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Music Name"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "Music Name"sv, quoted(name));
 			} catch (...) {}
 			try {
 				const auto& sounds = object->sounds;
 				for (const auto& soundItem : sounds) {
 					if (soundItem) {
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}Sound Chance"sv,
-								"",
-								tab_depth),
+						a_results.add(tab_depth, "Sound Chance"sv,
 							fmt::format(
 								"{:f}"sv,
 								soundItem->chance));
@@ -1856,11 +1533,7 @@ namespace Crash::Introspection::SSE
 								                 flagName :
 								                 flagString.append(" | "sv).append(flagName);
 						}
-						a_results.emplace_back(
-							fmt::format(
-								"{:\t>{}}Flags"sv,
-								"",
-								tab_depth),
+						a_results.add(tab_depth, "Flags"sv,
 							fmt::format(
 								"0x{:08X} {}"sv,
 								flags.underlying(),
@@ -1889,8 +1562,7 @@ namespace Crash::Introspection::SSE
 					const auto parentName = parent->GetFullName();
 					const auto parentFile = parent->GetDescriptionOwnerFile();
 					const auto parentFilename = parentFile ? parentFile->GetFilename() : ""sv;
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Parent Location"sv, "", tab_depth),
+					a_results.add(tab_depth, "Parent Location"sv,
 						fmt::format("\"{}\" [0x{:08X}]{}",
 							parentName ? parentName : "",
 							parent->GetFormID(),
@@ -1914,22 +1586,16 @@ namespace Crash::Introspection::SSE
 				return;
 			try {
 				const auto archetype = object->GetArchetype();
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Archetype"sv, "", tab_depth),
-					std::string(magic_enum::enum_name(archetype)));
+				a_results.add(tab_depth, "Archetype"sv, std::string(magic_enum::enum_name(archetype)));
 			} catch (...) {}
 			try {
 				const auto skill = object->GetMagickSkill();
 				if (skill != RE::ActorValue::kNone)
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Skill"sv, "", tab_depth),
-						std::string(magic_enum::enum_name(skill)));
+					a_results.add(tab_depth, "Skill"sv, std::string(magic_enum::enum_name(skill)));
 			} catch (...) {}
 			try {
 				if (object->IsHostile())
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Hostile"sv, "", tab_depth),
-						"true");
+					a_results.add(tab_depth, "Hostile"sv, "true");
 			} catch (...) {}
 		}
 	};
@@ -1947,19 +1613,13 @@ namespace Crash::Introspection::SSE
 			if (!object)
 				return;
 			try {
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}SpellType"sv, "", tab_depth),
-					std::string(magic_enum::enum_name(object->GetSpellType())));
+				a_results.add(tab_depth, "SpellType"sv, std::string(magic_enum::enum_name(object->GetSpellType())));
 			} catch (...) {}
 			try {
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}CastingType"sv, "", tab_depth),
-					std::string(magic_enum::enum_name(object->GetCastingType())));
+				a_results.add(tab_depth, "CastingType"sv, std::string(magic_enum::enum_name(object->GetCastingType())));
 			} catch (...) {}
 			try {
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Delivery"sv, "", tab_depth),
-					std::string(magic_enum::enum_name(object->GetDelivery())));
+				a_results.add(tab_depth, "Delivery"sv, std::string(magic_enum::enum_name(object->GetDelivery())));
 			} catch (...) {}
 		}
 	};
@@ -1973,32 +1633,24 @@ namespace Crash::Introspection::SSE
 			filter_results& a_results,
 			const void* a_ptr, int tab_depth = 0) noexcept
 		{
+			// Also nested under other filters: stop once the object's budget is used up
+			if (a_results.exhausted(tab_depth)) {
+				return;
+			}
+
 			const auto object = static_cast<const value_type*>(a_ptr);
 			if (!object)
 				return;
 			try {
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}Active Quest"sv,
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "Active Quest"sv,
 					fmt::format(
 						"{}",
 						object->IsActive()));
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}Current Stage"sv,
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "Current Stage"sv,
 					fmt::format(
 						"{}",
 						object->GetCurrentStageID()));
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}Type"sv,
-						"",
-						tab_depth),
-					magic_enum::enum_name(object->GetType()));
+				a_results.add(tab_depth, "Type"sv, std::string(magic_enum::enum_name(object->GetType())));
 			} catch (...) {}
 		};
 	};
@@ -2017,12 +1669,7 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto name = object->displayName.c_str();
 				if (name && name[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Display Name"sv,
-							"",
-							tab_depth),
-						quoted(name));
+					a_results.add(tab_depth, "Display Name"sv, quoted(name));
 			} catch (...) {}
 			try {
 				const auto& displayNameText = object->displayNameText;
@@ -2032,12 +1679,7 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto quest = object->ownerQuest;
 				if (quest) {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Owner Quest"sv,
-							""sv,
-							tab_depth),
-						""sv);
+					a_results.add(tab_depth, "Owner Quest"sv, "");
 					TESQuest::filter(a_results, quest, tab_depth + 1);
 				}
 			} catch (...) {}
@@ -2061,7 +1703,7 @@ namespace Crash::Introspection::SSE
 				auto currentStackFrame = object->stack->top;  // get stack from BSScript::Internal::CodeTasklet (or get stack directly if it's a stack object
 				std::string stackTrace = "\n";
 				std::map<std::string, bool> objectReferences;
-				while (currentStackFrame) {
+				while (currentStackFrame && !a_results.exhausted(tab_depth)) {
 					auto& function = currentStackFrame->owningFunction;
 					auto& functionObjecTypeName = function.get()->GetObjectTypeName();
 					auto& functionName = function.get()->GetName();
@@ -2090,13 +1732,11 @@ namespace Crash::Introspection::SSE
 					stackTrace = stackTrace + lineTrace;
 					currentStackFrame = currentStackFrame->previousFrame;
 				}
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}Stack Trace"sv,
-						"",
-						tab_depth),
-					stackTrace);
+				a_results.add(tab_depth, "Stack Trace"sv, stackTrace);
 				for (auto& objectReference : objectReferences) {
+					if (a_results.exhausted(tab_depth + 1)) {
+						break;
+					}
 					const auto& objectString = objectReference.first;
 					const auto modIndex = std::stoi(objectString.substr(0, 2), nullptr, 16);
 					const auto form = std::stoi(objectString.substr(3, objectString.size()), nullptr, 16);
@@ -2120,11 +1760,7 @@ namespace Crash::Introspection::SSE
 
 			try {
 				const auto formID = object->levItem;
-				a_results.emplace_back(
-					fmt::format(
-						"{:\t>{}}FormID"sv,
-						"",
-						tab_depth),
+				a_results.add(tab_depth, "FormID"sv,
 					fmt::format(
 						"0x{:08X}"sv,
 						formID));
@@ -2143,6 +1779,11 @@ namespace Crash::Introspection::SSE
 			filter_results& a_results,
 			const void* a_ptr, int tab_depth = 0) noexcept
 		{
+			// Also nested under other filters: stop once the object's budget is used up
+			if (a_results.exhausted(tab_depth)) {
+				return;
+			}
+
 			const auto object = static_cast<const value_type*>(a_ptr);
 
 			if (!object)
@@ -2150,31 +1791,16 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto script = object->script;
 				if (script && script->text && script->text[0])
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Script Text"sv,
-							"",
-							tab_depth),
-						quoted(script->text));
+					a_results.add(tab_depth, "Script Text"sv, quoted(script->text));
 				if (script && script->parentQuest) {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Parent Quest"sv,
-							"",
-							tab_depth),
-						""sv);
+					a_results.add(tab_depth, "Parent Quest"sv, "");
 					TESQuest::filter(a_results, script->parentQuest, tab_depth + 1);
 				}
 			} catch (...) {}
 			try {
 				const auto scriptLocals = object->effectLocals;
 				if (scriptLocals && scriptLocals->masterScript) {
-					a_results.emplace_back(
-						fmt::format(
-							"{:\t>{}}Master Script"sv,
-							""sv,
-							tab_depth),
-						""sv);
+					a_results.add(tab_depth, "Master Script"sv, "");
 					ScriptEffect::filter(a_results, scriptLocals->masterScript, tab_depth + 1);
 				}
 			} catch (...) {}
@@ -2197,42 +1823,30 @@ namespace Crash::Introspection::SSE
 			try {
 				const auto cullMode = object->cullMode.get();
 				const auto cullModeName = magic_enum::enum_name(cullMode);
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Cull Mode"sv, "", tab_depth),
-					fmt::format("{} ({})"sv, cullModeName, std::to_underlying(cullMode)));
+				a_results.add(tab_depth, "Cull Mode"sv, fmt::format("{} ({})"sv, cullModeName, std::to_underlying(cullMode)));
 			} catch (...) {}
 
 			try {
 				const auto objectCount = object->objectArray.size();
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Object Array Size"sv, "", tab_depth),
-					fmt::format("{}"sv, objectCount));
+				a_results.add(tab_depth, "Object Array Size"sv, fmt::format("{}"sv, objectCount));
 			} catch (...) {}
 
 			try {
 				const auto alphaGroupCount = object->alphaGroups.size();
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Alpha Groups Size"sv, "", tab_depth),
-					fmt::format("{}"sv, alphaGroupCount));
+				a_results.add(tab_depth, "Alpha Groups Size"sv, fmt::format("{}"sv, alphaGroupCount));
 			} catch (...) {}
 
 			try {
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Recurse to Geometry"sv, "", tab_depth),
-					fmt::format("{}"sv, object->recurseToGeometry));
+				a_results.add(tab_depth, "Recurse to Geometry"sv, fmt::format("{}"sv, object->recurseToGeometry));
 			} catch (...) {}
 
 			try {
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Is Grouping Alphas"sv, "", tab_depth),
-					fmt::format("{}"sv, object->isGroupingAlphas));
+				a_results.add(tab_depth, "Is Grouping Alphas"sv, fmt::format("{}"sv, object->isGroupingAlphas));
 			} catch (...) {}
 
 			try {
 				const auto cullModeStackIndex = object->cullModeStackIndex;
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Cull Mode Stack Index"sv, "", tab_depth),
-					fmt::format("{}"sv, cullModeStackIndex));
+				a_results.add(tab_depth, "Cull Mode Stack Index"sv, fmt::format("{}"sv, cullModeStackIndex));
 			} catch (...) {}
 		}
 	};
@@ -2252,32 +1866,24 @@ namespace Crash::Introspection::SSE
 
 			try {
 				const auto threadID = object->threadID;
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Thread ID"sv, "", tab_depth),
-					fmt::format("0x{:08X}"sv, threadID));
+				a_results.add(tab_depth, "Thread ID"sv, fmt::format("0x{:08X}"sv, threadID));
 			} catch (...) {}
 
 			try {
 				const auto ownerThreadID = object->ownerThreadID;
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Owner Thread ID"sv, "", tab_depth),
-					fmt::format("0x{:08X}"sv, ownerThreadID));
+				a_results.add(tab_depth, "Owner Thread ID"sv, fmt::format("0x{:08X}"sv, ownerThreadID));
 			} catch (...) {}
 
 			try {
 				const auto initialized = object->initialized;
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Initialized"sv, "", tab_depth),
-					fmt::format("{}"sv, initialized));
+				a_results.add(tab_depth, "Initialized"sv, fmt::format("{}"sv, initialized));
 			} catch (...) {}
 
 			try {
 				const auto bRunning = object->bRunning;
 				const auto bProcessing = object->bProcessing;
 				const auto bShutDown = object->bShutDown;
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Status"sv, "", tab_depth),
-					fmt::format("Running={}, Processing={}, ShutDown={}", bRunning, bProcessing, bShutDown));
+				a_results.add(tab_depth, "Status"sv, fmt::format("Running={}, Processing={}, ShutDown={}", bRunning, bProcessing, bShutDown));
 			} catch (...) {}
 
 			try {
@@ -2291,16 +1897,12 @@ namespace Crash::Introspection::SSE
 						stateStr += ", ";
 					stateStr += fmt::format("State[{}]: {} ({})", i, stateName.empty() ? "Unknown" : std::string(stateName), stateValue);
 				}
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}States"sv, "", tab_depth),
-					stateStr);
+				a_results.add(tab_depth, "States"sv, stateStr);
 			} catch (...) {}
 
 			try {
 				// Note: BSEventFlag doesn't have a public interface to check state
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Events"sv, "", tab_depth),
-					"NewWork, WorkDone");
+				a_results.add(tab_depth, "Events"sv, "NewWork, WorkDone");
 			} catch (...) {}
 		}
 	};
@@ -2320,23 +1922,17 @@ namespace Crash::Introspection::SSE
 
 			try {
 				const auto& runtimeData = object->GetRuntimeData();
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Active Lights"sv, "", tab_depth),
-					fmt::format("{}"sv, runtimeData.activeLights.size()));
+				a_results.add(tab_depth, "Active Lights"sv, fmt::format("{}"sv, runtimeData.activeLights.size()));
 			} catch (...) {}
 
 			try {
 				const auto& runtimeData = object->GetRuntimeData();
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Active Shadow Lights"sv, "", tab_depth),
-					fmt::format("{}"sv, runtimeData.activeShadowLights.size()));
+				a_results.add(tab_depth, "Active Shadow Lights"sv, fmt::format("{}"sv, runtimeData.activeShadowLights.size()));
 			} catch (...) {}
 
 			try {
 				const auto& runtimeData = object->GetRuntimeData();
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Lit Geometry"sv, "", tab_depth),
-					fmt::format("{}"sv, runtimeData.litGeometry.size()));
+				a_results.add(tab_depth, "Lit Geometry"sv, fmt::format("{}"sv, runtimeData.litGeometry.size()));
 			} catch (...) {}
 		}
 	};
@@ -2356,18 +1952,10 @@ namespace Crash::Introspection::SSE
 
 			try {
 				const auto& rd = object->GetRuntimeData();
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Game Active"sv, "", tab_depth),
-					fmt::format("{}"sv, rd.gameActive));
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}On Idle"sv, "", tab_depth),
-					fmt::format("{}"sv, rd.onIdle));
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Reload Content"sv, "", tab_depth),
-					fmt::format("{}"sv, rd.reloadContent));
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Freeze Time"sv, "", tab_depth),
-					fmt::format("{}"sv, rd.freezeTime));
+				a_results.add(tab_depth, "Game Active"sv, fmt::format("{}"sv, rd.gameActive));
+				a_results.add(tab_depth, "On Idle"sv, fmt::format("{}"sv, rd.onIdle));
+				a_results.add(tab_depth, "Reload Content"sv, fmt::format("{}"sv, rd.reloadContent));
+				a_results.add(tab_depth, "Freeze Time"sv, fmt::format("{}"sv, rd.freezeTime));
 			} catch (...) {}
 		}
 	};
@@ -2389,24 +1977,21 @@ namespace Crash::Introspection::SSE
 				const auto triCount = navmesh->triangles.size();
 				const auto vertCount = navmesh->vertices.size();
 
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Triangles"sv, "", tab_depth),
-					fmt::format("{}", triCount));
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Vertices"sv, "", tab_depth),
-					fmt::format("{}", vertCount));
+				a_results.add(tab_depth, "Triangles"sv, fmt::format("{}", triCount));
+				a_results.add(tab_depth, "Vertices"sv, fmt::format("{}", vertCount));
 
 				if (triCount > 0 && triCount <= 65536) {
 					std::size_t deletedTris = 0;
 					for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(triCount); ++i) {
+						if ((i & 0xFFF) == 0 && a_results.exhausted(tab_depth)) {
+							break;
+						}
 						if (navmesh->triangles[i].triangleFlags.any(RE::BSNavmeshTriangle::TriangleFlag::kDeleted)) {
 							++deletedTris;
 						}
 					}
 					if (deletedTris > 0) {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Deleted Triangles"sv, "", tab_depth),
-							fmt::format("{} ({:.1f}%)", deletedTris, deletedTris * 100.0f / static_cast<float>(triCount)));
+						a_results.add(tab_depth, "Deleted Triangles"sv, fmt::format("{} ({:.1f}%)", deletedTris, deletedTris * 100.0f / static_cast<float>(triCount)));
 					}
 				}
 			} catch (...) {}
@@ -2423,9 +2008,7 @@ namespace Crash::Introspection::SSE
 						if (ws) {
 							const auto wsName = ws->GetName();
 							if (wsName && wsName[0]) {
-								a_results.emplace_back(
-									fmt::format("{:\t>{}}WorldSpace"sv, "", tab_depth),
-									quoted(wsName));
+								a_results.add(tab_depth, "WorldSpace"sv, quoted(wsName));
 							}
 						}
 					}
@@ -2448,9 +2031,7 @@ namespace Crash::Introspection::SSE
 				const auto* loc = search->bestGoal;
 
 				if (!loc) {
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Target NavMesh"sv, "", tab_depth),
-						"no goal found"s);
+					a_results.add(tab_depth, "Target NavMesh"sv, "no goal found"s);
 					return;
 				}
 
@@ -2458,46 +2039,34 @@ namespace Crash::Introspection::SSE
 				const std::uint16_t triIdx = loc->triIndex;
 
 				if (!navmesh) {
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Target NavMesh"sv, "", tab_depth),
-						"null"s);
+					a_results.add(tab_depth, "Target NavMesh"sv, "null"s);
 					return;
 				}
 
 				const auto triCount = navmesh->triangles.size();
 				const auto vertCount = navmesh->vertices.size();
 
-				a_results.emplace_back(
-					fmt::format("{:\t>{}}Target Triangle"sv, "", tab_depth),
-					fmt::format("{}", triIdx));
+				a_results.add(tab_depth, "Target Triangle"sv, fmt::format("{}", triIdx));
 
 				if (triIdx >= triCount) {
-					a_results.emplace_back(
-						fmt::format("{:\t>{}}Target Triangle Status"sv, "", tab_depth),
-						fmt::format("OUT OF BOUNDS (index {} >= count {})", triIdx, triCount));
+					a_results.add(tab_depth, "Target Triangle Status"sv, fmt::format("OUT OF BOUNDS (index {} >= count {})", triIdx, triCount));
 				} else {
 					const auto& tri = navmesh->triangles[triIdx];
 
 					if (tri.triangleFlags.any(RE::BSNavmeshTriangle::TriangleFlag::kDeleted)) {
-						a_results.emplace_back(
-							fmt::format("{:\t>{}}Target Triangle Status"sv, "", tab_depth),
-							"DELETED"s);
+						a_results.add(tab_depth, "Target Triangle Status"sv, "DELETED"s);
 					}
 
 					for (int i = 0; i < 3; ++i) {
 						if (tri.vertices[i] >= vertCount) {
-							a_results.emplace_back(
-								fmt::format("{:\t>{}}Target Triangle vertex[{}]"sv, "", tab_depth, i),
-								fmt::format("OUT OF BOUNDS (index {} >= count {})", tri.vertices[i], vertCount));
+							a_results.add_dynamic(tab_depth, fmt::format("Target Triangle vertex[{}]"sv, i), fmt::format("OUT OF BOUNDS (index {} >= count {})", tri.vertices[i], vertCount));
 						}
 					}
 
 					for (int i = 0; i < 3; ++i) {
 						const auto neighborIdx = tri.triangles[i];
 						if (neighborIdx != 0xFFFF && neighborIdx >= triCount) {
-							a_results.emplace_back(
-								fmt::format("{:\t>{}}Target Triangle neighbor[{}]"sv, "", tab_depth, i),
-								fmt::format("OUT OF BOUNDS (index {} >= count {})", neighborIdx, triCount));
+							a_results.add_dynamic(tab_depth, fmt::format("Target Triangle neighbor[{}]"sv, i), fmt::format("OUT OF BOUNDS (index {} >= count {})", neighborIdx, triCount));
 						}
 					}
 				}
@@ -2522,30 +2091,156 @@ namespace Crash::Introspection
 		return it != a_modules.rend() && (*it)->in_range(a_ptr) ? it->get() : nullptr;
 	}
 
-	namespace detail
+	// Filters to run for each concrete class, resolved from its RTTI hierarchy on first sight.
+	// The same classes recur all over the stack; later objects of a class run their filters
+	// directly, without walking base descriptors, looking up mangled names or re-logging misses.
+	class FilterPlans
 	{
-		struct SeenObjectInfo
+	public:
+		using filter_t = void (*)(SSE::filter_results&, const void*, int) noexcept;
+
+		struct Step
 		{
-			std::string result;
-			std::size_t first_seen_pos;
-			std::string first_seen_label;  // Store the label string to avoid recalculation issues across blocks. Must be initialized at the same time as first_seen_pos to ensure consistency.
-			bool is_game_object;           // True for polymorphic game objects, false for void* with module info
+			filter_t filter;
+			std::ptrdiff_t adjust;  // from the analyzed pointer to the filtered base subobject
 		};
-		static std::unordered_map<const void*, SeenObjectInfo> seen_objects;
-		static std::mutex seen_objects_mutex;  // Protects seen_objects from race conditions
-		static std::function<std::string(size_t)> label_generator;
-		static thread_local std::size_t current_analysis_pos = 0;
-		static std::size_t total_backfill_count = 0;
-		static bool backfill_logged_this_crash = false;
-
-		// Generate a label for the current position
-		// Uses label_generator if available, otherwise falls back to address string
-		// Uses thread_local current_analysis_pos so each thread gets its own position; overall thread-safety depends on label_generator
-		[[nodiscard]] inline std::string generate_current_label(const void* a_ptr)
-		{
-			return label_generator ? label_generator(current_analysis_pos) : fmt::format("0x{:X}", reinterpret_cast<std::uintptr_t>(a_ptr));
+
+		using Plan = std::vector<Step>;
+
+		// Cached plan for a_col, built by a_build() if this is the first object of its class.
+		// inserted is true for the one caller whose plan was stored, even if workers raced.
+		template <class F>
+		[[nodiscard]] std::pair<const Plan&, bool> get(const RE::RTTI::CompleteObjectLocator* a_col, F&& a_build)
+		{
+			{
+				std::shared_lock lock{ _mutex };
+				if (const auto it = _plans.find(a_col); it != _plans.end()) {
+					_hits.fetch_add(1, std::memory_order_relaxed);
+					return { it->second, false };
+				}
+			}
+			auto plan = a_build();  // outside the lock: reads RTTI, may log
+			std::unique_lock lock{ _mutex };
+			const auto [it, inserted] = _plans.try_emplace(a_col, std::move(plan));
+			return { it->second, inserted };  // node-based map: the reference survives rehashing
+		}
+
+		[[nodiscard]] std::size_t size() const
+		{
+			std::shared_lock lock{ _mutex };
+			return _plans.size();
+		}
+
+		// Objects that reused a cached plan
+		[[nodiscard]] std::size_t hits() const noexcept { return _hits.load(std::memory_order_relaxed); }
+
+	private:
+		mutable std::shared_mutex _mutex;
+		std::unordered_map<const RE::RTTI::CompleteObjectLocator*, Plan> _plans;
+		std::atomic<std::size_t> _hits{ 0 };
+	};
+
+	// Per-analysis answers to "is this integer a live FormID?". Most stack values in FormID range
+	// name no loaded plugin, and a bit test over the loaded compile indices rejects them without
+	// going through TESDataHandler. Values that pass are looked up once; the same form often sits
+	// in several frames, and repeats are served from the memo.
+	class FormIDIndex
+	{
+	public:
+		struct Entry
+		{
+			RE::TESForm* form;
+			bool active;
+		};
+
+		// False if a_formID's plugin index is not loaded; the bitsets are built on first use
+		[[nodiscard]] bool plausible(std::uint32_t a_formID)
+		{
+			std::call_once(_built, [this]() { build(); });
+			const auto modIdx = a_formID >> 24;
+			const bool loaded = modIdx == 0xFE ? _lightMods.test((a_formID >> 12) & 0xFFF) : _mods.test(modIdx);
+			if (!loaded) {
+				_rejected.fetch_add(1, std::memory_order_relaxed);
+			}
+			return loaded;
 		}
 
+		// Cached result for a_formID, resolved by a_resolve() -> Entry on first sight
+		template <class F>
+		[[nodiscard]] Entry lookup(std::uint32_t a_formID, F&& a_resolve)
+		{
+			{
+				std::shared_lock lock{ _mutex };
+				if (const auto it = _memo.find(a_formID); it != _memo.end()) {
+					_hits.fetch_add(1, std::memory_order_relaxed);
+					return it->second;
+				}
+			}
+			const Entry entry = a_resolve();  // outside the lock: the form lookup takes the game's own lock
+			std::unique_lock lock{ _mutex };
+			_memo.try_emplace(a_formID, entry);
+			return entry;
+		}
+
+		// Values rejected by the bit test, and lookups answered from the memo
+		[[nodiscard]] std::pair<std::size_t, std::size_t> usage() const noexcept
+		{
+			return { _rejected.load(std::memory_order_relaxed), _hits.load(std::memory_order_relaxed) };
+		}
+
+	private:
+		void build() noexcept
+		{
+			try {
+				const auto dataHandler = RE::TESDataHandler::GetSingleton();
+				if (!dataHandler) {
+					return;
+				}
+				const auto& files = dataHandler->GetLoadedMods();
+				for (std::uint32_t i = 0; i < dataHandler->GetLoadedModCount(); ++i) {
+					if (files[i]) {
+						_mods.set(files[i]->GetCompileIndex());
+					}
+				}
+				const auto& smallFiles = dataHandler->GetLoadedLightMods();
+				for (std::uint32_t i = 0; i < dataHandler->GetLoadedLightModCount(); ++i) {
+					if (smallFiles[i]) {
+						_lightMods.set(smallFiles[i]->GetSmallFileCompileIndex() & 0xFFF);
+					}
+				}
+			} catch (...) {
+			}
+		}
+
+		std::once_flag _built;
+		std::bitset<0x100> _mods;
+		std::bitset<0x1000> _lightMods;
+		mutable std::shared_mutex _mutex;
+		std::unordered_map<std::uint32_t, Entry> _memo;
+		std::atomic<std::size_t> _rejected{ 0 };
+		std::atomic<std::size_t> _hits{ 0 };
+	};
+
+	namespace detail
+	{
+		// The value currently being analyzed: which analysis it belongs to, how positions in the
+		// current analyze_data() call are labelled, and its position there. Passed by reference
+		// into record() so concurrent analyses never share label or position state.
+		struct Cursor
+		{
+			AnalysisContext& context;
+			const std::function<std::string(std::size_t)>& label_generator;
+			std::size_t pos;
+			std::uintptr_t value;
+
+			// Generate a label for the current position
+			// Uses label_generator if available, otherwise falls back to address string
+			[[nodiscard]] std::string label(const void* a_ptr) const
+			{
+				return label_generator ? label_generator(pos) : fmt::format("0x{:X}", reinterpret_cast<std::uintptr_t>(a_ptr));
+			}
+		};
+
 		// Check if a demangled type name is a game-relevant object
 		// Returns false for STL types, internal implementation classes, etc.
 		[[nodiscard]] bool is_game_relevant_type(std::string_view demangled) noexcept
@@ -2576,7 +2271,7 @@ namespace Crash::Introspection
 			{
 			}
 
-			[[nodiscard]] std::string name() const { return name_string; }
+			[[nodiscard]] Record record() const { return { .kind = Record::Kind::Integer, .header = name_string }; }
 
 		private:
 			const std::size_t _value;
@@ -2596,31 +2291,30 @@ namespace Crash::Introspection
 				}
 			}
 
-			[[nodiscard]] std::string name() const
+			[[nodiscard]] RecordHandle record(const Cursor& a_cursor) const
 			{
 				// Check if this address was already introspected as a known object
-				{
-					std::lock_guard<std::mutex> lock(seen_objects_mutex);
-					auto it = seen_objects.find(_ptr);
-					if (it != seen_objects.end() && !it->second.result.empty()) {
-						return it->second.result;  // Return the full object information
-					}
+				if (const auto known = a_cursor.context.seen_objects().visit(_ptr, [](const SeenObjectInfo* a_info) {
+						return a_info ? a_info->record : nullptr;
+					})) {
+					a_cursor.context.records().note_shared(known);
+					return known;  // Return the full object information
 				}
 
 				if (_module) {
 					const auto address = reinterpret_cast<std::uintptr_t>(_ptr);
 					const auto pdbDetails = Crash::PDB::pdb_details(_module->path(), address - _module->address());
 					const auto assembly = _module->assembly((const void*)address);
-					std::string result;
+					Record result{ .kind = Record::Kind::Pointer, .address = a_cursor.value };
 					if (!pdbDetails.empty())
-						result = fmt::format(
+						result.header = fmt::format(
 							"(void* -> {}+{:07X}\t{} | {})"sv,
 							_module->name(),
 							address - _module->address(),
 							assembly,
 							pdbDetails);
 					else
-						result = fmt::format(
+						result.header = fmt::format(
 							"(void* -> {}+{:07X}\t{})"sv,
 							_module->name(),
 							address - _module->address(),
@@ -2628,13 +2322,11 @@ namespace Crash::Introspection
 
 					// Store in seen_objects to prevent duplicate introspection
 					// Mark as NOT a game object (just a void* with module info)
-					{
-						std::lock_guard<std::mutex> lock(seen_objects_mutex);
-						seen_objects.try_emplace(_ptr, result, current_analysis_pos, generate_current_label(_ptr), false);
-					}
-					return result;
+					const auto handle = a_cursor.context.records().intern(std::move(result));
+					a_cursor.context.seen_objects().try_emplace(_ptr, SeenObjectInfo{ handle, a_cursor.pos, a_cursor.label(_ptr), false }, [](auto&&, bool) {});
+					return handle;
 				} else {
-					return "(void*)"s;
+					return a_cursor.context.records().intern({ .kind = Record::Kind::Pointer, .address = a_cursor.value, .header = "(void*)"s });
 				}
 			}
 
@@ -2643,6 +2335,33 @@ namespace Crash::Introspection
 			const void* _ptr{ nullptr };
 		};
 
+		// Pointer into the range of a DLL that has since been unloaded: either the value itself,
+		// or the first qword (vtable slot) of the object it points to
+		class UnloadedPointer
+		{
+		public:
+			UnloadedPointer(const void* a_ptr, const Modules::UnloadedModule& a_module, bool a_viaVtable) :
+				_name(a_module.name),
+				_offset(reinterpret_cast<std::uintptr_t>(a_ptr) - a_module.base),
+				_viaVtable(a_viaVtable)
+			{}
+
+			[[nodiscard]] Record record() const
+			{
+				return {
+					.kind = Record::Kind::Unloaded,
+					.header = _viaVtable ?
+					              fmt::format("(void* -> object with stale vtable in unloaded {}+{:07X})"sv, _name, _offset) :
+					              fmt::format("(void* -> unloaded {}+{:07X})"sv, _name, _offset)
+				};
+			}
+
+		private:
+			std::string _name;
+			std::uintptr_t _offset;
+			bool _viaVtable;
+		};
+
 		class Polymorphic
 		{
 		public:
@@ -2654,7 +2373,9 @@ namespace Crash::Introspection
 				assert(_mangled.size() > 1 && _mangled.data()[_mangled.size()] == '\0');
 			}
 
+			// Only overridden for objects reached through a FormID
 			void set_header(std::string a_header) noexcept { _header = std::move(a_header); }
+			[[nodiscard]] bool via_form_id() const noexcept { return !_header.empty(); }
 
 			[[nodiscard]] std::string demangled_name() const { return Crash::PDB::demangle(std::string{ _mangled }); }
 
@@ -2664,35 +2385,46 @@ namespace Crash::Introspection
 				return _header.empty() ? fmt::format("({}*)"sv, demangled) : _header;
 			}
 
-			[[nodiscard]] std::string name() const
+			// Record for this object without filter output or cross-reference; demangles once
+			[[nodiscard]] Record make_record() const
+			{
+				Record result{ .kind = Record::Kind::Object, .type = demangled_name(), .viaFormID = via_form_id() };
+				result.header = result.viaFormID ? _header : fmt::format("({}*)"sv, result.type);
+				return result;
+			}
+
+			[[nodiscard]] RecordHandle record(const Cursor& a_cursor) const
 			{
-				auto result = get_formatted_name();
+				auto result = make_record();
+				result.address = a_cursor.value;
 
 				// Check if this address was already introspected
 				if (_ptr) {
 					// Determine if this is a game object before acquiring the lock
-					const std::string demangled = demangled_name();
-					bool is_game_obj = is_game_relevant_type(demangled);
-
-					// Use check-and-reserve pattern
-					{
-						std::lock_guard<std::mutex> lock(seen_objects_mutex);
-						auto [it, inserted] = seen_objects.try_emplace(_ptr, SeenObjectInfo{ result, current_analysis_pos, generate_current_label(_ptr), is_game_obj });
-
-						if (!inserted) {
+					bool is_game_obj = is_game_relevant_type(result.type);
+
+					// Use check-and-reserve pattern; the record is interned only by the worker that
+					// stores it, so a duplicate sighting never leaves an unused copy in the pool
+					return a_cursor.context.seen_objects().try_emplace(
+						_ptr,
+						SeenObjectInfo{ nullptr, a_cursor.pos, a_cursor.label(_ptr), is_game_obj },
+						[&](SeenObjectInfo& a_info, bool a_inserted) -> RecordHandle {
+							if (a_inserted) {
+								a_info.record = a_cursor.context.records().intern(std::move(result));
+								return a_info.record;
+							}
 							// If we're at the same position where it was first seen, return the stored result
-							if (current_analysis_pos == it->second.first_seen_pos) {
-								return it->second.result;
+							if (a_cursor.pos == a_info.first_seen_pos && a_info.record) {
+								a_cursor.context.records().note_shared(a_info.record);
+								return a_info.record;
 							}
-
 							// Object already being processed or completed - return cross-reference
-							return fmt::format("{} See {}", result, it->second.first_seen_label);
-						}
-						// else: we successfully stored this object, return the result
-					}
+							result.see = a_info.first_seen_label;
+							return a_cursor.context.records().intern(std::move(result));
+						});
 				}
 
-				return result;
+				return a_cursor.context.records().intern(std::move(result));
 			}
 
 		private:
@@ -2719,77 +2451,110 @@ namespace Crash::Introspection
 			void set_header(std::string a_header) noexcept { _poly.set_header(std::move(a_header)); }
 			[[nodiscard]] std::string demangled_name() const { return _poly.demangled_name(); }
 
-			[[nodiscard]] std::string name() const
+			[[nodiscard]] RecordHandle record(const Cursor& a_cursor) const
 			{
-				std::size_t reserved_pos = 0;
-				bool was_inserted = false;
-
 				// Use check-and-reserve pattern to prevent re-entrancy
+				struct Existing
 				{
-					std::lock_guard<std::mutex> lock(seen_objects_mutex);
-					auto [it, inserted] = seen_objects.try_emplace(_ptr, SeenObjectInfo{ "", current_analysis_pos, generate_current_label(_ptr), true });
-					was_inserted = inserted;
-					reserved_pos = current_analysis_pos;
-
-					if (!inserted) {
-						// Object already exists (either being processed or completed)
-
+					RecordHandle result;  // set when returning the stored result as-is
+					std::string label;
+					bool pending;
+				};
+				auto existing = a_cursor.context.seen_objects().try_emplace(
+					_ptr,
+					SeenObjectInfo{ nullptr, a_cursor.pos, a_cursor.label(_ptr), true },
+					[&](const SeenObjectInfo& a_info, bool a_inserted) -> std::optional<Existing> {
+						if (a_inserted) {
+							return std::nullopt;  // we successfully reserved this slot, continue with introspection
+						}
 						// If we're at the same position where it was first seen, return the stored result
 						// (This happens on the second analysis pass for printing)
-						if (current_analysis_pos == it->second.first_seen_pos && !it->second.result.empty()) {
-							return it->second.result;
+						if (a_cursor.pos == a_info.first_seen_pos && a_info.record) {
+							return Existing{ a_info.record, {}, false };
 						}
+						return Existing{ nullptr, a_info.first_seen_label, !a_info.record };
+					});
+
+				if (existing) {
+					// Object already exists (either being processed or completed)
+					if (existing->result) {
+						a_cursor.context.records().note_shared(existing->result);
+						return existing->result;
+					}
 
-						// Different position - generate cross-reference
-						auto poly_name = _poly.get_formatted_name();
-
-						if (it->second.result.empty()) {
-							// Being processed by another thread or recursively - return placeholder
-							return fmt::format("({}) See {}", poly_name, it->second.first_seen_label);
+					// Different position - generate cross-reference (demangling happens outside the table lock)
+					// pending: being processed by another thread or recursively - rendered as a placeholder
+					auto reference = _poly.make_record();
+					reference.address = a_cursor.value;
+					reference.see = std::move(existing->label);
+					reference.pending = existing->pending;
+					return a_cursor.context.records().intern(std::move(reference));
+				}
+
+				auto result = _poly.make_record();
+				result.address = a_cursor.value;
+				const auto& limits = a_cursor.context.limits();
+				const auto stop = limits.objectBudget.count() > 0 ?
+				                      std::min(limits.deadline, std::chrono::steady_clock::now() + limits.objectBudget) :
+				                      limits.deadline;
+				SSE::filter_results xInfo{ stop, limits.maxDepth };
+
+				std::vector<const char*> unhandled;
+				const auto [plan, inserted] = a_cursor.context.filter_plans().get(_col, [&]() {
+					FilterPlans::Plan steps;
+					const auto moduleBase = REL::Module::get().base();
+					const auto hierarchy = _col->classDescriptor.get();
+					const std::span bases(
+						reinterpret_cast<std::uint32_t*>(hierarchy->baseClassArray.offset() + moduleBase),
+						hierarchy->numBaseClasses);
+					for (const auto rva : bases) {
+						const auto base = reinterpret_cast<RE::RTTI::BaseClassDescriptor*>(rva + moduleBase);
+						const auto it = FILTERS.find(base->typeDescriptor->mangled_name());
+						if (it != FILTERS.end()) {
+							steps.push_back({ it->second, static_cast<std::ptrdiff_t>(base->pmd.mDisp) - static_cast<std::ptrdiff_t>(_col->offset) });
 						} else {
-							// Already completed - return cross-reference
-							return fmt::format("{} See {}", poly_name, it->second.first_seen_label);
+							unhandled.push_back(base->typeDescriptor->mangled_name());
 						}
 					}
-					// else: we successfully reserved this slot, continue with introspection
-				}
-
-				auto result = _poly.get_formatted_name();
-				SSE::filter_results xInfo;
-
-				const auto moduleBase = REL::Module::get().base();
-				const auto hierarchy = _col->classDescriptor.get();
-				const std::span bases(
-					reinterpret_cast<std::uint32_t*>(hierarchy->baseClassArray.offset() + moduleBase),
-					hierarchy->numBaseClasses);
-				for (const auto rva : bases) {
-					const auto base = reinterpret_cast<RE::RTTI::BaseClassDescriptor*>(rva + moduleBase);
-					const auto it = FILTERS.find(base->typeDescriptor->mangled_name());
-					if (it != FILTERS.end()) {
-						const auto root = util::adjust_pointer<void>(_ptr, -static_cast<std::ptrdiff_t>(_col->offset));
-						const auto target = util::adjust_pointer<void>(root, static_cast<std::ptrdiff_t>(base->pmd.mDisp));
-						it->second(xInfo, target, 0);
-					} else {
+					return steps;
+				});
+
+				// Unhandled bases are reported once per class, by whoever stored its plan
+				if (inserted) {
+					for (const auto mangled_name : unhandled) {
 						// Demangle the type name for better readability using the improved PDB demangler
-						const char* mangled_name = base->typeDescriptor->mangled_name();
 						if (mangled_name && mangled_name[0] != '\0') {
 							std::string demangled_info = Crash::PDB::demangle(std::string(mangled_name));
-							logger::info("Found unhandled type:\t{}\t{} [{}]"sv, result, mangled_name, demangled_info);
+							logger::info("Found unhandled type:\t{}\t{} [{}]"sv, result.header, mangled_name, demangled_info);
 						} else {
-							logger::info("Found unhandled type:\t{}\t<null>"sv, result);
+							logger::info("Found unhandled type:\t{}\t<null>"sv, result.header);
 						}
 					}
 				}
 
+				for (const auto& step : plan) {
+					if (xInfo.exhausted(0)) {
+						break;
+					}
+					step.filter(xInfo, util::adjust_pointer<void>(_ptr, step.adjust), 0);
+				}
+				if (xInfo.truncated()) {
+					a_cursor.context.note_truncated();
+				}
+
 				// Post-process filters to reduce verbosity and improve header
 				std::string rootFile, rootName, rootFormID, rootFormType, rootFlags;
 				std::size_t rootFileIdx = std::string::npos, rootNameIdx = std::string::npos,
 							rootFormIDIdx = std::string::npos, rootFormTypeIdx = std::string::npos, rootFlagsIdx = std::string::npos;
 
-				for (std::size_t i = 0; i < xInfo.size(); ++i) {
-					const auto& key = xInfo[i].first;
-					const auto& val = xInfo[i].second;
-					// Only match root-level keys (no leading tabs) to avoid matching nested "Full Name", "Skeleton Name", etc.
+				auto& fields = xInfo.fields();
+				for (std::size_t i = 0; i < fields.size(); ++i) {
+					// Only match root-level keys to avoid matching nested "Full Name", "Skeleton Name", etc.
+					if (fields[i].depth != 0) {
+						continue;
+					}
+					const auto key = fields[i].key();
+					const auto& val = fields[i].value;
 					if (key == "File") {
 						rootFile = val;
 						rootFileIdx = i;
@@ -2810,78 +2575,62 @@ namespace Crash::Introspection
 
 				// Append to header
 				if (!rootName.empty())
-					result += fmt::format(" {}"sv, rootName);
+					result.header += fmt::format(" {}"sv, rootName);
 				if (!rootFormID.empty())
-					result += fmt::format(" [{}]"sv, rootFormID);
+					result.header += fmt::format(" [{}]"sv, rootFormID);
 				if (!rootFile.empty())
-					result += fmt::format(" ({})"sv, rootFile);
+					result.header += fmt::format(" ({})"sv, rootFile);
 
 				// Mark for removal.
 				// FormID and File are lifted into the header, so remove all occurrences.
 				// FormType and Flags are kept as expanded fields but deduplicated (keep first only).
 				// Multiple filter matches in the base-class hierarchy (e.g. NavMesh + TESForm)
 				// can emit the same fields more than once.
-				std::vector<bool> remove(xInfo.size(), false);
+				std::vector<bool> remove(fields.size(), false);
 				bool seenFormType = false, seenFlags = false;
-				for (std::size_t i = 0; i < xInfo.size(); ++i) {
-					const auto& key = xInfo[i].first;
-					const auto& val = xInfo[i].second;
+				for (std::size_t i = 0; i < fields.size(); ++i) {
+					const auto depth = fields[i].depth;
+					const auto key = fields[i].key();
+					const auto& val = fields[i].value;
 					// Always strip root-level FormID and File (shown in header)
-					if (key == "FormID" || key == "File")
+					if (depth == 0 && (key == "FormID" || key == "File"))
 						remove[i] = true;
 					// Deduplicate FormType and Flags — keep only the first occurrence
-					else if (key == "FormType") {
+					else if (depth == 0 && key == "FormType") {
 						if (seenFormType)
 							remove[i] = true;
 						else
 							seenFormType = true;
-					} else if (key == "Flags") {
+					} else if (depth == 0 && key == "Flags") {
 						if (seenFlags)
 							remove[i] = true;
 						else
 							seenFlags = true;
 					}
 					// Remove Name/File duplicates at any nesting depth
-					if ((key == "Name" || key.find("\tName") == 0) && val == rootName)
+					if (((depth == 0 && key == "Name") || (depth == 1 && key.starts_with("Name"))) && val == rootName)
 						remove[i] = true;
-					if ((key.find("\tFile") == 0) && val == rootFile)
+					if (depth == 1 && key.starts_with("File") && val == rootFile)
 						remove[i] = true;
 				}
 
-				if (!xInfo.empty()) {
-					for (std::size_t i = 0; i < xInfo.size(); ++i) {
-						if (!remove[i]) {
-							result += fmt::format(
-								"\n\t\t{}: {}"sv,
-								xInfo[i].first,
-								xInfo[i].second);
-						}
+				for (std::size_t i = 0; i < fields.size(); ++i) {
+					if (!remove[i]) {
+						result.fields.push_back(std::move(fields[i]));
 					}
 				}
 
 				// Check if this is a game-relevant type (filter out STL types)
-				// Extract the type name from result: "(TypeName*)"
-				std::string_view result_view(result);
-				std::size_t start = result_view.find('(');
-				std::size_t end = result_view.find("*)");
-				bool is_game_obj = true;  // Default to true for F4 types
+				const bool is_game_obj = is_game_relevant_type(result.type);
 
-				if (start != std::string_view::npos && end != std::string_view::npos && end > start) {
-					std::string_view type_name = result_view.substr(start + 1, end - start - 1);
-					is_game_obj = is_game_relevant_type(type_name);
-				}
+				// Publish the complete result to the reserved slot
+				const auto handle = a_cursor.context.records().intern(std::move(result));
+				a_cursor.context.seen_objects().update(_ptr, [&](SeenObjectInfo& a_info) {
+					a_info.record = handle;
+					a_info.is_game_object = is_game_obj;
+				});
 
-				// Update the reserved slot with the complete result
-				{
-					std::lock_guard<std::mutex> lock(seen_objects_mutex);
-					auto it = seen_objects.find(_ptr);
-					if (it != seen_objects.end()) {
-						it->second.result = result;
-						it->second.is_game_object = is_game_obj;
-					}
-				}
-
-				return result;
+				return handle;
 			}
 
 		private:
@@ -2943,17 +2692,22 @@ namespace Crash::Introspection
 		class String
 		{
 		public:
-			String(std::string_view a_str) noexcept :
-				_str(a_str)
+			String(std::string_view a_str, bool a_wide = false) :
+				_str(a_str),
+				_wide(a_wide)
 			{}
 
-			[[nodiscard]] std::string name() const
+			[[nodiscard]] Record record() const
 			{
-				return fmt::format("(char*) \"{}\""sv, _str);
+				return {
+					.kind = Record::Kind::String,
+					.header = _wide ? fmt::format("(wchar_t*) L\"{}\""sv, _str) : fmt::format("(char*) \"{}\""sv, _str)
+				};
 			}
 
 		private:
-			std::string_view _str;
+			std::string _str;  // copied out, the source may be freed or changed by a running thread
+			bool _wide;        // UTF-16 in memory; only printable ASCII is accepted, so _str is exact
 		};
 
 		class HeapPointer
@@ -2964,11 +2718,14 @@ namespace Crash::Introspection
 				_info(a_info)
 			{}
 
-			[[nodiscard]] std::string name() const
+			[[nodiscard]] Record record() const
 			{
-				return fmt::format("(void*) 0x{:012X} [Heap: {}]"sv,
-					reinterpret_cast<std::uintptr_t>(_ptr),
-					Heap::format_heap_info(_info));
+				return {
+					.kind = Record::Kind::Pointer,
+					.header = fmt::format("(void*) 0x{:012X} [Heap: {}]"sv,
+						reinterpret_cast<std::uintptr_t>(_ptr),
+						Heap::format_heap_info(_info))
+				};
 			}
 
 		private:
@@ -2982,7 +2739,8 @@ namespace Crash::Introspection
 			Polymorphic,
 			F4Polymorphic,
 			String,
-			HeapPointer>;
+			HeapPointer,
+			UnloadedPointer>;
 
 		template <class T, class... Args>
 		[[nodiscard]] analysis_result make_result(Args&&... a_args) noexcept(
@@ -2997,16 +2755,25 @@ namespace Crash::Introspection
 			-> std::optional<analysis_result>
 		{
 			try {
-				const auto vtable = *reinterpret_cast<void**>(a_ptr);
+				const auto vtable = SafeMemory::read<void*>(a_ptr).value_or(nullptr);
+				if (!vtable) {
+					return std::nullopt;
+				}
 				const auto mod = get_module_for_pointer(vtable, a_modules);
-				if (!mod || !mod->in_rdata_range(vtable)) {
+				if (!mod) {
+					if (const auto unloaded = Modules::get_unloaded_module(vtable)) {
+						return make_result<UnloadedPointer>(vtable, *unloaded, true);
+					}
+					return std::nullopt;
+				}
+				if (!mod->in_rdata_range(vtable)) {
 					return std::nullopt;
 				}
 
-				const auto col =
-					*reinterpret_cast<RE::RTTI::CompleteObjectLocator**>(
-						reinterpret_cast<std::size_t*>(vtable) - 1);
-				if (mod != get_module_for_pointer(col, a_modules) || !mod->in_rdata_range(col)) {
+				const auto col = SafeMemory::read<RE::RTTI::CompleteObjectLocator*>(
+					reinterpret_cast<std::size_t*>(vtable) - 1)
+				                     .value_or(nullptr);
+				if (!col || mod != get_module_for_pointer(col, a_modules) || !mod->in_rdata_range(col)) {
 					return std::nullopt;
 				}
 
@@ -3017,7 +2784,7 @@ namespace Crash::Introspection
 					return std::nullopt;
 				}
 
-				if (*reinterpret_cast<const void**>(typeDesc) != mod->type_info()) {
+				if (SafeMemory::read<const void*>(typeDesc).value_or(nullptr) != mod->type_info()) {
 					return std::nullopt;
 				}
 
@@ -3035,34 +2802,19 @@ namespace Crash::Introspection
 			-> std::optional<analysis_result>
 		{
 			try {
-				const auto printable = [](char a_ch) noexcept {
-					if (' ' <= a_ch && a_ch <= '~') {
-						return true;
-					} else {
-						switch (a_ch) {
-						case '\t':
-						case '\n':
-							return true;
-						default:
-							return false;
-						}
-					}
-				};
-
-				const auto str = static_cast<const char*>(a_ptr);
 				constexpr std::size_t max = 1000;
-				std::size_t len = 0;
-				for (; len < max && str[len] != '\0'; ++len) {
-					if (!printable(str[len])) {
-						return std::nullopt;
-					}
-				}
-
-				if (len == 0 || len >= max) {
+				alignas(16) char str[max];
+				alignas(16) char16_t wstr[max / 2];
+				const auto found = StringScan::find_string(a_ptr, str, wstr, SafeMemory::read_bytes);
+				if (!found) {
 					return std::nullopt;
 				}
-
-				return make_result<String>(std::string_view{ str, len });
+				if (found->wide) {
+					std::string ascii(found->length, '\0');
+					std::transform(wstr, wstr + found->length, ascii.begin(), [](char16_t a_ch) { return static_cast<char>(a_ch); });
+					return make_result<String>(ascii, true);
+				}
+				return make_result<String>(std::string_view{ str, found->length });
 			} catch (...) {
 				return std::nullopt;
 			}
@@ -3120,32 +2872,22 @@ namespace Crash::Introspection
 			return false;
 		}
 
-		[[nodiscard]] bool check_mod_index(std::uint32_t a_formID)
-		{
-			const auto modIdx = a_formID >> 24;
-			const auto dataHandler = RE::TESDataHandler::GetSingleton();
-			if (!dataHandler)
-				return false;
-
-			if (modIdx == 0xFE) {
-				const auto lightIdx = static_cast<std::uint16_t>((a_formID >> 12) & 0xFFF);
-				return dataHandler->LookupLoadedLightModByIndex(lightIdx) != nullptr;
-			}
-
-			return dataHandler->LookupLoadedModByIndex(static_cast<std::uint8_t>(modIdx)) != nullptr;
-		}
-
 		[[nodiscard]] auto analyze_integer(
 			std::size_t a_value,
-			std::span<const module_pointer> a_modules) noexcept
+			std::span<const module_pointer> a_modules,
+			FormIDIndex& a_formIDs) noexcept
 			-> analysis_result
 		{
 			try {
 				if (a_value && a_value <= std::numeric_limits<std::uint32_t>::max()) {
-					if (check_mod_index(static_cast<std::uint32_t>(a_value))) {
-						const auto formId = static_cast<RE::FormID>(a_value);
-						if (auto form = RE::TESForm::LookupByID(formId)) {
-							if (check_form_active(form)) {
+					const auto formId = static_cast<RE::FormID>(a_value);
+					if (a_formIDs.plausible(formId)) {
+						const auto [form, active] = a_formIDs.lookup(formId, [&]() {
+							const auto found = RE::TESForm::LookupByID(formId);
+							return FormIDIndex::Entry{ found, found && check_form_active(found) };
+						});
+						if (form) {
+							if (active) {
 								auto result_opt = analyze_polymorphic(form, a_modules);
 								if (result_opt) {
 									auto& res = *result_opt;
@@ -3175,8 +2917,14 @@ namespace Crash::Introspection
 				}
 
 				if (a_value != 0) {
-					*reinterpret_cast<const volatile std::byte*>(a_value);
-					return analyze_pointer(reinterpret_cast<void*>(a_value), a_modules);
+					// Freed module ranges are usually unmapped, so classify before probing
+					if (const auto unloaded = Modules::get_unloaded_module(reinterpret_cast<const void*>(a_value))) {
+						return make_result<UnloadedPointer>(reinterpret_cast<const void*>(a_value), *unloaded, false);
+					}
+					// Consult the region map instead of faulting on every garbage value
+					if (SafeMemory::is_readable(reinterpret_cast<const void*>(a_value))) {
+						return analyze_pointer(reinterpret_cast<void*>(a_value), a_modules);
+					}
 				}
 			} catch (...) {}
 
@@ -3184,70 +2932,144 @@ namespace Crash::Introspection
 		}
 	}
 
-	void reset_analysis_state() noexcept
+	AnalysisContext::AnalysisContext(std::pmr::memory_resource* a_resource) :
+		_seen(std::make_unique<SeenObjects>(a_resource)),
+		_records(std::make_unique<RecordPool>(a_resource)),
+		_filterPlans(std::make_unique<FilterPlans>()),
+		_formIDs(std::make_unique<FormIDIndex>()),
+		_skipped(a_resource)
+	{}
+
+	AnalysisContext::~AnalysisContext() = default;
+
+	bool AnalysisContext::was_introspected(const void* a_ptr) const noexcept
+	{
+		// Return true ONLY if the object is a game object (polymorphic type)
+		// Exclude void* pointers with module info (those are not game objects)
+		try {
+			return _seen->visit(a_ptr, [](const SeenObjectInfo* a_info) {
+				return a_info && a_info->is_game_object;
+			});
+		} catch (...) {
+			return false;
+		}
+	}
+
+	std::size_t AnalysisContext::lock_contention() const noexcept
+	{
+		return _seen->contention();
+	}
+
+	std::vector<std::string> AnalysisContext::skipped() const
+	{
+		std::lock_guard lock{ _skippedLock };
+		return { _skipped.begin(), _skipped.end() };
+	}
+
+	void AnalysisContext::note_skipped(std::string a_label)
+	{
+		std::lock_guard lock{ _skippedLock };
+		_skipped.push_back(std::move(a_label));
+	}
+
+	std::pair<std::size_t, std::size_t> AnalysisContext::filter_plan_usage() const
 	{
-		std::lock_guard<std::mutex> lock(detail::seen_objects_mutex);
-		detail::seen_objects.clear();
-		detail::backfill_logged_this_crash = false;
-		detail::total_backfill_count = 0;
+		return { _filterPlans->size(), _filterPlans->hits() };
 	}
 
-	std::vector<std::string> analyze_data(
+	std::pair<std::size_t, std::size_t> AnalysisContext::form_id_usage() const noexcept
+	{
+		return _formIDs->usage();
+	}
+
+	std::vector<RecordHandle> analyze_data(
+		AnalysisContext& a_context,
 		std::span<const std::size_t> a_data,
 		std::span<const module_pointer> a_modules,
 		std::function<std::string(size_t)> a_label_generator)
 	{
-		detail::label_generator = a_label_generator;
-		std::vector<std::string> results;
+		auto& records = a_context.records();
+		std::vector<RecordHandle> results;
 		results.resize(a_data.size());
+
+		// Only words that could be a FormID or a pointer go through the full analysis
+		std::vector<StackWords::Candidate> candidates;
+		StackWords::prefilter(a_data, candidates);
+		a_context.seen_objects().reserve(candidates.size());
 		std::for_each(
 			std::execution::par_unseq,
-			a_data.begin(),
-			a_data.end(),
-			[&](auto& a_val) {
-				const auto pos = std::addressof(a_val) - a_data.data();
-				detail::current_analysis_pos = static_cast<std::size_t>(pos);
-				const auto result = detail::analyze_integer(a_val, a_modules);
-				results[pos] = std::visit(
-					[](const auto& a_analysis) { return a_analysis.name(); },
+			candidates.begin(),
+			candidates.end(),
+			[&](const StackWords::Candidate& a_candidate) {
+				const detail::Cursor cursor{ a_context, a_label_generator, a_candidate.index, a_data[a_candidate.index] };
+				if (a_context.past_deadline()) {
+					// Out of time: keep the raw value and list the slot instead of risking another stall
+					auto record = detail::Integer(cursor.value).record();
+					record.address = cursor.value;
+					record.header += " (not analyzed: introspection deadline)"sv;
+					a_context.note_skipped(cursor.label(reinterpret_cast<const void*>(cursor.value)));
+					results[cursor.pos] = records.intern(std::move(record));
+					return;
+				}
+				const auto result = detail::analyze_integer(cursor.value, a_modules, a_context.form_ids());
+				results[cursor.pos] = std::visit(
+					[&](const auto& a_analysis) -> RecordHandle {
+						if constexpr (requires { a_analysis.record(cursor); }) {
+							return a_analysis.record(cursor);
+						} else {
+							auto record = a_analysis.record();
+							record.address = cursor.value;
+							return records.intern(std::move(record));
+						}
+					},
 					result);
 			});
+
+		// Everything else can only ever print as an integer
+		auto next = candidates.begin();
+		for (std::size_t pos = 0; pos < a_data.size(); ++pos) {
+			if (next != candidates.end() && next->index == pos) {
+				++next;
+				continue;
+			}
+			auto record = detail::Integer(a_data[pos]).record();
+			record.address = a_data[pos];
+			results[pos] = records.intern(std::move(record));
+		}
 		return results;
 	}
 }
 
-void Crash::Introspection::backfill_void_pointers(std::vector<std::string>& a_results, std::span<const std::size_t> a_addresses)
+void Crash::Introspection::backfill_void_pointers(AnalysisContext& a_context, std::vector<RecordHandle>& a_results, std::span<const std::size_t> a_addresses)
 {
 	assert(a_results.size() == a_addresses.size());
 
+	std::size_t backfilled = 0;
 	for (std::size_t i = 0; i < a_results.size(); ++i) {
 		auto& result = a_results[i];
 		std::size_t addr = a_addresses[i];
 
 		// Only process entries that are still void* pointers (not already replaced)
-		if (result.starts_with("(void*")) {
+		if (result->is_pointer()) {
 			// Check if this address points to a known object
-			auto it = detail::seen_objects.find(reinterpret_cast<const void*>(addr));
-			if (it != detail::seen_objects.end()) {
-				// Replace with full object information
-				result = it->second.result;
-				++detail::total_backfill_count;
+			const auto found = a_context.seen_objects().visit(reinterpret_cast<const void*>(addr), [&](const SeenObjectInfo* a_info) {
+				if (a_info && a_info->record && a_info->record != result) {
+					// Replace with full object information
+					result = a_info->record;
+					a_context.records().note_shared(result);
+					return true;
+				}
+				return false;
+			});
+			if (found) {
+				++backfilled;
 			}
 		}
 	}
 
-	// Log the backfill statistics (only once per crash)
-	if (!detail::backfill_logged_this_crash && detail::total_backfill_count > 0) {
-		logger::info("Backfilled {} void* pointers with known object information across all analysis", detail::total_backfill_count);
-		detail::backfill_logged_this_crash = true;
+	// Log the backfill statistics (only once per analysis)
+	const auto total = a_context._backfilled.fetch_add(backfilled) + backfilled;
+	if (total > 0 && !a_context._backfillLogged.exchange(true)) {
+		logger::info("Backfilled {} void* pointers with known object information across all analysis", total);
 	}
 }
-
-bool Crash::Introspection::was_introspected(const void* a_ptr) noexcept
-{
-	// Return true ONLY if the object is a game object (polymorphic type)
-	// Exclude void* pointers with module info (those are not game objects)
-	std::lock_guard<std::mutex> lock(detail::seen_objects_mutex);
-	auto it = detail::seen_objects.find(a_ptr);
-	return it != detail::seen_objects.end() && it->second.is_game_object;
-}
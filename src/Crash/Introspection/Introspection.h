@@ -1,7 +1,15 @@
 #pragma once
 
+#include "Crash/Introspection/Record.h"
+
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace Crash
 {
@@ -12,28 +20,97 @@ namespace Crash
 
 	namespace Introspection
 	{
+		class FilterPlans;
+		class FormIDIndex;
+		class SeenObjects;
+
 		[[nodiscard]] const Modules::Module* get_module_for_pointer(
 			const void* a_ptr,
 			std::span<const std::unique_ptr<Modules::Module>> a_modules) noexcept;
 
-		// Reset introspection state for a new crash analysis
-		// Should be called once at the beginning of crash analysis, not per block
-		// Thread-safe: can be called from any thread
-		void reset_analysis_state() noexcept;
+		// Bounds on how long introspection may run, so one pathological object cannot stall a log
+		struct Limits
+		{
+			// Values not reached by then are printed as plain integers and listed by skipped()
+			std::chrono::steady_clock::time_point deadline{ std::chrono::steady_clock::time_point::max() };
+			std::chrono::milliseconds objectBudget{ 0 };  // per object's type filters; 0 = unlimited
+			int maxDepth{ 0 };                            // nesting of filter output; 0 = unlimited
+		};
+
+		// State shared by every analyze_data() call of one analysis (a crash log, or one dumped
+		// thread): which addresses were already introspected, for "See RSP+XX" cross-references
+		// and backfill, the records they produced, plus statistics. Independent contexts can be
+		// analyzed concurrently. Record handles returned by analyze_data() live as long as the context.
+		class AnalysisContext
+		{
+		public:
+			// Tables and records of this analysis come from a_resource; the crash handler passes the
+			// emergency arena so logging a crash does not depend on the process heap
+			explicit AnalysisContext(std::pmr::memory_resource* a_resource = std::pmr::get_default_resource());
+			~AnalysisContext();
+
+			AnalysisContext(const AnalysisContext&) = delete;
+			AnalysisContext& operator=(const AnalysisContext&) = delete;
+
+			// Check if an address is a game object (polymorphic type with introspection)
+			// Returns false for void* pointers with module info (those are not game objects)
+			[[nodiscard]] bool was_introspected(const void* a_ptr) const noexcept;
+
+			// Times an introspection worker had to wait for another one's lock on the seen-objects table
+			[[nodiscard]] std::size_t lock_contention() const noexcept;
+
+			void set_limits(const Limits& a_limits) noexcept { _limits = a_limits; }
+			[[nodiscard]] const Limits& limits() const noexcept { return _limits; }
+			[[nodiscard]] bool past_deadline() const noexcept { return std::chrono::steady_clock::now() >= _limits.deadline; }
+
+			// Labels of values left unanalyzed because the deadline passed, in no particular order
+			[[nodiscard]] std::vector<std::string> skipped() const;
+			void note_skipped(std::string a_label);
 
-		// Analyze data and return introspection results
-		// Thread-safe: uses parallel execution with internal mutex protection
-		// The seen_objects map persists across multiple analyze_data() calls until reset_analysis_state()
-		[[nodiscard]] std::vector<std::string> analyze_data(
+			// Objects whose filter output was cut short by the time or depth budget
+			[[nodiscard]] std::size_t truncated() const noexcept { return _truncated.load(std::memory_order_relaxed); }
+			void note_truncated() noexcept { _truncated.fetch_add(1, std::memory_order_relaxed); }
+
+			// Classes with a cached filter plan, and objects that reused one instead of walking RTTI
+			[[nodiscard]] std::pair<std::size_t, std::size_t> filter_plan_usage() const;
+
+			// Integers rejected by the FormID plugin-index test, and FormID lookups served from the memo
+			[[nodiscard]] std::pair<std::size_t, std::size_t> form_id_usage() const noexcept;
+
+			// Number of void* entries replaced by backfill_void_pointers() so far
+			[[nodiscard]] std::size_t backfill_count() const noexcept { return _backfilled.load(std::memory_order_relaxed); }
+
+			[[nodiscard]] SeenObjects& seen_objects() const noexcept { return *_seen; }
+			[[nodiscard]] RecordPool& records() const noexcept { return *_records; }
+			[[nodiscard]] FilterPlans& filter_plans() const noexcept { return *_filterPlans; }
+			[[nodiscard]] FormIDIndex& form_ids() const noexcept { return *_formIDs; }
+
+		private:
+			friend void backfill_void_pointers(AnalysisContext&, std::vector<RecordHandle>&, std::span<const std::size_t>);
+
+			std::unique_ptr<SeenObjects> _seen;
+			std::unique_ptr<RecordPool> _records;
+			std::unique_ptr<FilterPlans> _filterPlans;
+			std::unique_ptr<FormIDIndex> _formIDs;
+			Limits _limits;
+			mutable std::mutex _skippedLock;
+			std::pmr::vector<std::string> _skipped;
+			std::atomic<std::size_t> _truncated{ 0 };
+			std::atomic<std::size_t> _backfilled{ 0 };
+			std::atomic_bool _backfillLogged{ false };
+		};
+
+		// Analyze data and return a handle to one introspection record per value (render() for the text)
+		// Thread-safe: uses parallel execution; labels come from a_label_generator (called with the
+		// index into a_data) and are local to this call
+		// Objects seen here are remembered in a_context for later calls sharing the same context
+		[[nodiscard]] std::vector<RecordHandle> analyze_data(
+			AnalysisContext& a_context,
 			std::span<const std::size_t> a_data,
 			std::span<const std::unique_ptr<Modules::Module>> a_modules,
 			std::function<std::string(size_t)> a_label_generator = nullptr);
 
 		// Backfill void* entries in analysis results with known object information
-		void backfill_void_pointers(std::vector<std::string>& a_results, std::span<const std::size_t> a_addresses);
-
-		// Check if an address is a game object (polymorphic type with introspection)
-		// Returns false for void* pointers with module info (those are not game objects)
-		[[nodiscard]] bool was_introspected(const void* a_ptr) noexcept;
+		void backfill_void_pointers(AnalysisContext& a_context, std::vector<RecordHandle>& a_results, std::span<const std::size_t> a_addresses);
 	}
 }
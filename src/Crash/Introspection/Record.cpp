@@ -0,0 +1,75 @@
+#include "Crash/Introspection/Record.h"
+
+#include <thread>
+
+namespace Crash::Introspection
+{
+	const std::string* Record::field(std::string_view a_key) const noexcept
+	{
+		for (const auto& field : fields) {
+			if (field.depth == 0 && field.key() == a_key) {
+				return std::addressof(field.value);
+			}
+		}
+		return nullptr;
+	}
+
+	std::string Record::render() const
+	{
+		std::string result;
+		if (see.empty()) {
+			result = header;
+		} else if (pending) {
+			result = fmt::format("({}) See {}"sv, header, see);
+		} else {
+			result = fmt::format("{} See {}"sv, header, see);
+		}
+
+		for (const auto& field : fields) {
+			result += fmt::format("\n\t\t{:\t>{}}{}: {}"sv, "", field.depth, field.key(), field.value);
+		}
+		return result;
+	}
+
+	std::size_t Record::footprint() const noexcept
+	{
+		std::size_t bytes = sizeof(Record) + type.capacity() + header.capacity() + see.capacity();
+		for (const auto& field : fields) {
+			bytes += sizeof(Field) + field.owned.capacity() + field.value.capacity();
+		}
+		return bytes;
+	}
+
+	RecordPool::RecordPool(std::pmr::memory_resource* a_resource) :
+		_shards(make_shards(a_resource, std::make_index_sequence<SHARD_COUNT>{}))
+	{}
+
+	RecordPool::Handle RecordPool::intern(Record&& a_record)
+	{
+		// Shard by worker thread so parallel analyze_data() workers rarely share a lock
+		auto& shard = _shards[std::hash<std::thread::id>{}(std::this_thread::get_id()) % SHARD_COUNT];
+		const auto bytes = a_record.footprint();
+
+		std::lock_guard lock{ shard.mutex };
+		const auto& stored = shard.records.emplace_back(std::move(a_record));
+		_records.fetch_add(1, std::memory_order_relaxed);
+		_bytes.fetch_add(bytes, std::memory_order_relaxed);
+		return std::addressof(stored);
+	}
+
+	void RecordPool::note_shared(Handle a_handle) noexcept
+	{
+		if (a_handle) {
+			_sharedBytes.fetch_add(a_handle->footprint(), std::memory_order_relaxed);
+		}
+	}
+
+	RecordPool::Stats RecordPool::stats() const noexcept
+	{
+		return {
+			_records.load(std::memory_order_relaxed),
+			_bytes.load(std::memory_order_relaxed),
+			_sharedBytes.load(std::memory_order_relaxed)
+		};
+	}
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Crash::Introspection
+{
+	// Key/value line produced by a type filter. Nesting is kept as a depth and turned into
+	// indentation by Record::render(), so keys stay plain (and usually static) strings.
+	struct Field
+	{
+		std::string_view literal;  // static key
+		std::string owned;         // key built at runtime (e.g. "Texture[Diffuse]"), else empty
+		std::string value;
+		std::uint8_t depth{ 0 };
+
+		[[nodiscard]] std::string_view key() const noexcept { return owned.empty() ? literal : std::string_view{ owned }; }
+	};
+
+	using Fields = std::vector<Field>;
+
+	// One analyzed value in structured form. Analyzers fill it in, text is produced by render()
+	// only when a section prints it, and backfill, relevance filtering and simplification work
+	// on the fields instead of parsing that text back.
+	struct Record
+	{
+		enum class Kind : std::uint8_t
+		{
+			Integer,   // plain number
+			Pointer,   // void*: into a module, into a heap block, or unidentified
+			Unloaded,  // void* into a module that has since been unloaded
+			String,    // char*
+			Object     // polymorphic object identified through RTTI
+		};
+
+		Kind kind{ Kind::Integer };
+		std::uintptr_t address{ 0 };  // the analyzed value; shared records keep their first sighting's
+		std::string type;             // demangled type name (Object)
+		std::string header;           // first line, e.g. "(TESNPC*) Name [0x00000007] (Skyrim.esm)"
+		Fields fields;                // filter output, already deduplicated against the header
+		std::string see;              // label of the first sighting when this is a cross-reference
+		bool pending{ false };        // cross-reference to an object another worker is still introspecting
+		bool viaFormID{ false };      // reached by resolving the value as a FormID
+
+		[[nodiscard]] bool is_pointer() const noexcept { return kind == Kind::Pointer || kind == Kind::Unloaded; }
+		[[nodiscard]] bool is_cross_reference() const noexcept { return !see.empty(); }
+
+		// Value of the first root-level field named a_key, or nullptr
+		[[nodiscard]] const std::string* field(std::string_view a_key) const noexcept;
+
+		// Full text as printed in the registers and stack sections
+		[[nodiscard]] std::string render() const;
+
+		// Approximate heap bytes held by this record, including its strings
+		[[nodiscard]] std::size_t footprint() const noexcept;
+	};
+
+	// Owns every Record of one analysis. A record is stored once and referenced by handle from the
+	// seen-objects table, the analyze_data() results and the relevant-objects list, so a multi-KB
+	// object description is never copied. Handles stay valid for the pool's lifetime.
+	class RecordPool
+	{
+	public:
+		using Handle = const Record*;
+
+		// Records are stored in memory from a_resource; the crash handler passes the emergency arena
+		explicit RecordPool(std::pmr::memory_resource* a_resource = std::pmr::get_default_resource());
+
+		// Thread-safe
+		[[nodiscard]] Handle intern(Record&& a_record);
+
+		// Account for a_handle being referenced again where a copy used to be made
+		void note_shared(Handle a_handle) noexcept;
+
+		struct Stats
+		{
+			std::size_t records{ 0 };
+			std::size_t bytes{ 0 };        // footprint of all stored records
+			std::size_t sharedBytes{ 0 };  // footprint of references that would have been copies
+		};
+
+		[[nodiscard]] Stats stats() const noexcept;
+
+	private:
+		static constexpr std::size_t SHARD_COUNT = 16;
+
+		struct alignas(64) Shard
+		{
+			explicit Shard(std::pmr::memory_resource* a_resource) :
+				records(a_resource)
+			{}
+
+			std::mutex mutex;
+			std::pmr::deque<Record> records;  // deque: growth never moves stored records
+		};
+
+		template <std::size_t... I>
+		[[nodiscard]] static std::array<Shard, SHARD_COUNT> make_shards(std::pmr::memory_resource* a_resource, std::index_sequence<I...>)
+		{
+			return { Shard(((void)I, a_resource))... };
+		}
+
+		std::array<Shard, SHARD_COUNT> _shards;
+		std::atomic<std::size_t> _records{ 0 };
+		std::atomic<std::size_t> _bytes{ 0 };
+		std::atomic<std::size_t> _sharedBytes{ 0 };
+	};
+
+	using RecordHandle = RecordPool::Handle;
+}
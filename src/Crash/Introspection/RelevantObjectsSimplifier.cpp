@@ -7,40 +7,26 @@ namespace Crash::Introspection
 {
 	namespace
 	{
-		// Helper to extract value for a specific key from filter output
-		std::string extract_field(std::string_view analysis, std::string_view key_name)
+		// Helper to extract the first line of a root-level field's value, trimmed of spaces and quotes
+		std::string extract_field(const Record& a_record, std::string_view key_name)
 		{
-			std::string search_key = std::string("\n\t\t") + std::string(key_name) + ":";
-			auto key_pos = analysis.find(search_key);
-			if (key_pos == std::string_view::npos) {
+			const auto field = a_record.field(key_name);
+			if (!field) {
 				return "";
 			}
 
-			// Move past the key and colon
-			auto value_start = key_pos + search_key.length();
-
-			// Skip leading whitespace
-			while (value_start < analysis.length() && analysis[value_start] == ' ') {
-				value_start++;
-			}
-
-			// Find end of line
-			auto value_end = analysis.find('\n', value_start);
-			if (value_end == std::string_view::npos) {
-				value_end = analysis.length();
-			}
-
-			std::string value(analysis.substr(value_start, value_end - value_start));
+			std::string_view value(*field);
+			value = value.substr(0, value.find('\n'));
 
 			// Trim quotes
 			while (!value.empty() && (value.front() == '\"' || value.front() == ' ')) {
-				value = value.substr(1);
+				value.remove_prefix(1);
 			}
 			while (!value.empty() && (value.back() == '\"' || value.back() == ' ')) {
-				value.pop_back();
+				value.remove_suffix(1);
 			}
 
-			return value;
+			return std::string(value);
 		}
 
 		// Extract the best line from a stack trace (for CodeTasklet)
@@ -96,22 +82,21 @@ namespace Crash::Introspection
 		}
 	}
 
-	std::string simplify_for_relevant_objects(std::string_view full_analysis)
+	std::string simplify_for_relevant_objects(const Record& full_analysis)
 	{
 		// NOTE: This function performs DISPLAY FORMATTING, not filtering.
 		// Filtering decisions are made by RelevantObjectsCollection::add() using was_introspected().
-		// This string inspection checks the FORMAT of the analysis output to determine how to display it.
 
 		// Check if this has filter output (detailed game object)
-		auto detail_pos = full_analysis.find("\n\t\t");
-		if (detail_pos == std::string_view::npos) {
+		if (full_analysis.fields.empty()) {
 			// No filter output - return the analysis as-is (e.g., simple polymorphic pointers like "(NiCamera*)")
 			// This ensures that introspected objects without detailed properties are still displayed
-			return std::string(full_analysis);
+			return full_analysis.render();
 		}
 
-		// Extract type name
-		std::string type_name(full_analysis.substr(0, detail_pos));
+		// Header line, e.g. "(TESQuest*) Name [0x...] (File.esp)"; special cases key off the RTTI type
+		const std::string& type_name = full_analysis.header;
+		const std::string_view rtti_type = full_analysis.type;
 
 		// Extract key fields (only first-level, tab_depth=0)
 		std::string name = extract_field(full_analysis, "Name");
@@ -143,7 +128,7 @@ namespace Crash::Introspection
 		// Build concise output based on type
 
 		// Special case: BSScript::NF_util::NativeFunctionBase
-		if (type_name.find("NativeFunctionBase") != std::string::npos) {
+		if (rtti_type.find("NativeFunctionBase") != std::string_view::npos) {
 			if (!object.empty() && !function.empty()) {
 				if (!state.empty()) {
 					return type_name + " " + object + "." + function + "() {State=" + state + "}";
@@ -154,7 +139,7 @@ namespace Crash::Introspection
 		}
 
 		// Special case: BSScript::ObjectTypeInfo
-		if (type_name.find("ObjectTypeInfo") != std::string::npos) {
+		if (rtti_type.find("ObjectTypeInfo") != std::string_view::npos) {
 			if (!name.empty()) {
 				return type_name + " " + name;
 			}
@@ -162,7 +147,7 @@ namespace Crash::Introspection
 		}
 
 		// Special case: CodeTasklet with stack trace
-		if (type_name.find("CodeTasklet") != std::string::npos && !stack_trace.empty()) {
+		if (rtti_type.find("CodeTasklet") != std::string_view::npos && !stack_trace.empty()) {
 			std::string best_line = extract_best_stack_line(stack_trace);
 			if (!best_line.empty()) {
 				return type_name + " " + best_line;
@@ -170,7 +155,7 @@ namespace Crash::Introspection
 		}
 
 		// Special case: TESQuest
-		if (type_name.find("TESQuest") != std::string::npos) {
+		if (rtti_type.find("TESQuest") != std::string_view::npos) {
 			std::string result = type_name;
 			if (!best_name.empty()) {
 				result += " \"" + best_name + "\"";
@@ -203,7 +188,7 @@ namespace Crash::Introspection
 		}
 
 		// Special case: SpellItem — show cast type and delivery alongside name
-		if (type_name.find("SpellItem") != std::string::npos) {
+		if (rtti_type.find("SpellItem") != std::string_view::npos) {
 			std::string result = type_name;
 			if (!best_name.empty())
 				result += " \"" + best_name + "\"";
@@ -234,7 +219,7 @@ namespace Crash::Introspection
 		}
 
 		// Special case: EffectSetting — show archetype alongside name
-		if (type_name.find("EffectSetting") != std::string::npos) {
+		if (rtti_type.find("EffectSetting") != std::string_view::npos) {
 			std::string result = type_name;
 			if (!best_name.empty())
 				result += " \"" + best_name + "\"";
@@ -1,11 +1,12 @@
 #pragma once
 
+#include "Crash/Introspection/Record.h"
+
 #include <string>
-#include <string_view>
 
 namespace Crash::Introspection
 {
-	// Converts full introspection analysis output into a concise single-line summary
+	// Converts a full introspection record into a concise single-line summary
 	// suitable for "Relevant Objects" section in crash logs.
 	//
 	// Returns empty string if the analysis doesn't contain useful object info.
@@ -15,5 +16,5 @@ namespace Crash::Introspection
 	//   NativeFunctionBase: Actor.StartCombat()
 	//   ObjectTypeInfo: MyCustomScript
 	//   CodeTasklet: Stack: [(00012345)].MyScript.OnUpdate() - "MyScript.psc" Line 42
-	[[nodiscard]] std::string simplify_for_relevant_objects(std::string_view full_analysis);
+	[[nodiscard]] std::string simplify_for_relevant_objects(const Record& full_analysis);
 }
@@ -0,0 +1,20 @@
+#include "Crash/Introspection/SeenObjects.h"
+
+namespace Crash::Introspection
+{
+	void SeenObjects::reserve(std::size_t a_expected)
+	{
+		std::lock_guard lock{ _mutex };
+		_map.reserve(_map.size() + a_expected);
+	}
+
+	void SeenObjects::clear() noexcept
+	{
+		try {
+			std::lock_guard lock{ _mutex };
+			_map.clear();
+		} catch (...) {
+		}
+		_contended.store(0, std::memory_order_relaxed);
+	}
+}
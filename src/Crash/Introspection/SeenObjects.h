@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Crash/Introspection/Record.h"
+
+#include <atomic>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Crash::Introspection
+{
+	struct SeenObjectInfo
+	{
+		RecordHandle record;           // nullptr while the first sighting is still being introspected
+		std::size_t first_seen_pos;
+		std::string first_seen_label;  // Store the label string to avoid recalculation issues across blocks. Must be initialized at the same time as first_seen_pos to ensure consistency.
+		bool is_game_object;           // True for polymorphic game objects, false for void* with module info
+	};
+
+	// Address -> first sighting, shared by all introspection workers of one analysis.
+	// One lock covers the whole table; every critical section is a single hash lookup.
+	class SeenObjects
+	{
+	public:
+		// Entries are allocated from a_resource; the crash handler passes the emergency arena
+		explicit SeenObjects(std::pmr::memory_resource* a_resource = std::pmr::get_default_resource()) :
+			_map(a_resource)
+		{}
+
+		// Pre-size for a_expected more entries so workers don't rehash under the lock
+		void reserve(std::size_t a_expected);
+
+		void clear() noexcept;
+
+		// Calls a_visitor(const SeenObjectInfo*) under the lock; nullptr if a_ptr is unknown
+		template <class F>
+		decltype(auto) visit(const void* a_ptr, F&& a_visitor) const
+		{
+			const auto lock = acquire();
+			const auto it = _map.find(a_ptr);
+			return a_visitor(it != _map.end() ? std::addressof(it->second) : nullptr);
+		}
+
+		// Inserts a_info if a_ptr is unknown, then calls a_visitor(SeenObjectInfo&, bool inserted)
+		// under the lock. Build a_info before calling so the lock only covers the lookup.
+		template <class F>
+		decltype(auto) try_emplace(const void* a_ptr, SeenObjectInfo&& a_info, F&& a_visitor)
+		{
+			const auto lock = acquire();
+			auto [it, inserted] = _map.try_emplace(a_ptr, std::move(a_info));
+			return a_visitor(it->second, inserted);
+		}
+
+		// Calls a_update(SeenObjectInfo&) under the lock if a_ptr is known
+		template <class F>
+		void update(const void* a_ptr, F&& a_update)
+		{
+			const auto lock = acquire();
+			if (const auto it = _map.find(a_ptr); it != _map.end()) {
+				a_update(it->second);
+			}
+		}
+
+		// Number of lock acquisitions that had to wait for another worker
+		[[nodiscard]] std::size_t contention() const noexcept { return _contended.load(std::memory_order_relaxed); }
+
+	private:
+		[[nodiscard]] std::unique_lock<std::mutex> acquire() const
+		{
+			std::unique_lock lock{ _mutex, std::try_to_lock };
+			if (!lock.owns_lock()) {
+				_contended.fetch_add(1, std::memory_order_relaxed);
+				lock.lock();
+			}
+			return lock;
+		}
+
+		mutable std::mutex _mutex;
+		std::pmr::unordered_map<const void*, SeenObjectInfo> _map;
+		mutable std::atomic<std::size_t> _contended{ 0 };
+	};
+}
@@ -0,0 +1,275 @@
+#include "Crash/Modules/CodePatches.h"
+
+#include "Crash/Disassembly.h"
+#include "Crash/Introspection/Introspection.h"
+
+#include <emmintrin.h>
+
+namespace Crash::Modules
+{
+	namespace
+	{
+		// Equal bytes allowed inside one patch before it is split (e.g. a rel32 whose high bytes happen to match)
+		constexpr std::size_t MERGE_GAP = 8;
+
+		// A section this different from disk is packed/encrypted on disk, not patched
+		constexpr std::size_t PACKED_RATIO = 4;  // more than 1/4 of the bytes differ
+
+		constexpr std::size_t MAX_PATCHES = 1u << 16;
+
+		// First index >= a_start where a_lhs and a_rhs differ, or a_size. SSE2 is baseline on x64;
+		// 64 bytes are compared per iteration and only a differing block is narrowed bytewise.
+		[[nodiscard]] std::size_t find_mismatch(const std::byte* a_lhs, const std::byte* a_rhs, std::size_t a_start, std::size_t a_size) noexcept
+		{
+			auto i = a_start;
+			for (; i + 64 <= a_size; i += 64) {
+				const auto eq0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a_lhs + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_rhs + i)));
+				const auto eq1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a_lhs + i + 16)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_rhs + i + 16)));
+				const auto eq2 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a_lhs + i + 32)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_rhs + i + 32)));
+				const auto eq3 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a_lhs + i + 48)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_rhs + i + 48)));
+				const auto all = _mm_and_si128(_mm_and_si128(eq0, eq1), _mm_and_si128(eq2, eq3));
+				if (_mm_movemask_epi8(all) != 0xFFFF) {
+					break;
+				}
+			}
+			for (; i + 16 <= a_size; i += 16) {
+				const auto eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a_lhs + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_rhs + i)));
+				const auto mask = static_cast<unsigned>(_mm_movemask_epi8(eq)) ^ 0xFFFFu;
+				if (mask != 0) {
+					return i + std::countr_zero(mask);
+				}
+			}
+			for (; i < a_size; ++i) {
+				if (a_lhs[i] != a_rhs[i]) {
+					return i;
+				}
+			}
+			return a_size;
+		}
+
+		struct Range
+		{
+			std::size_t offset;
+			std::size_t size;
+		};
+
+		// Diff a_memory against a_disk into a_out. The live image is read under SEH in case a
+		// plugin has made a code page inaccessible; kept free of unwindable objects (MSVC C2712).
+		// Returns false if the section could not be read.
+		bool safe_diff(const std::byte* a_memory, const std::byte* a_disk, std::size_t a_size,
+			Range* a_out, std::size_t a_max, std::size_t& a_count, std::size_t& a_differing) noexcept
+		{
+			a_count = 0;
+			a_differing = 0;
+			__try {
+				auto i = find_mismatch(a_memory, a_disk, 0, a_size);
+				while (i < a_size) {
+					// Extend over differing bytes, bridging short equal gaps
+					auto end = i + 1;
+					for (auto gap = std::size_t{ 0 }; end < a_size && gap <= MERGE_GAP; ++end) {
+						gap = a_memory[end] == a_disk[end] ? gap + 1 : 0;
+					}
+					while (end > i + 1 && a_memory[end - 1] == a_disk[end - 1]) {
+						--end;
+					}
+
+					a_differing += end - i;
+					if (a_count < a_max) {
+						a_out[a_count++] = { i, end - i };
+					}
+					i = find_mismatch(a_memory, a_disk, end, a_size);
+				}
+				return true;
+			} __except (EXCEPTION_EXECUTE_HANDLER) {
+				return false;
+			}
+		}
+
+		[[nodiscard]] std::string_view section_name(const ::IMAGE_SECTION_HEADER& a_section) noexcept
+		{
+			const auto name = reinterpret_cast<const char*>(a_section.Name);
+			return { name, ::strnlen(name, IMAGE_SIZEOF_SHORT_NAME) };
+		}
+
+		// Follow a JMP/CALL (and up to one trampoline hop) until it lands inside a loaded module
+		[[nodiscard]] std::string resolve_target(std::uintptr_t a_patch, std::span<const module_pointer> a_modules)
+		{
+			const auto describe = [&](std::uintptr_t a_addr) -> std::string {
+				const auto mod = Introspection::get_module_for_pointer(reinterpret_cast<const void*>(a_addr), a_modules);
+				return mod ? fmt::format("{}+{:07X}"sv, mod->name(), a_addr - mod->address()) : ""s;
+			};
+
+			// A rewritten rel32 leaves the opcode untouched, so the branch may start a few bytes earlier
+			for (std::size_t back = 0; back < 5; ++back) {
+				const auto branch = Disassembly::branch_target(reinterpret_cast<const void*>(a_patch - back));
+				if (!branch || branch->length <= back) {
+					continue;
+				}
+
+				auto target = branch->target;
+				if (auto found = describe(target); !found.empty()) {
+					return found;
+				}
+				// Hooks usually detour through an allocated trampoline
+				if (const auto hop = Disassembly::branch_target(reinterpret_cast<const void*>(target))) {
+					if (auto found = describe(hop->target); !found.empty()) {
+						return found;
+					}
+				}
+				return fmt::format("0x{:X}"sv, target);
+			}
+			return {};
+		}
+
+		std::once_flag scanned;
+		std::vector<CodePatch> patches;  // sorted by address; written once under scanned
+
+		void scan(const Module& a_module, std::span<const module_pointer> a_modules)
+		{
+			const auto file = ::CreateFileW(std::filesystem::path{ a_module.path() }.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+				nullptr, OPEN_EXISTING, 0, nullptr);
+			if (file == INVALID_HANDLE_VALUE) {
+				logger::warn("Code patch census: cannot open {}"sv, a_module.path());
+				return;
+			}
+			// SEC_IMAGE lays the file out by RVA without applying relocations
+			const auto mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY | SEC_IMAGE, 0, 0, nullptr);
+			::CloseHandle(file);
+			if (!mapping) {
+				logger::warn("Code patch census: cannot map {}"sv, a_module.path());
+				return;
+			}
+			const auto view = static_cast<const std::byte*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			::CloseHandle(mapping);
+			if (!view) {
+				logger::warn("Code patch census: cannot view {}"sv, a_module.path());
+				return;
+			}
+
+			try {
+				const auto dosHeader = reinterpret_cast<const ::IMAGE_DOS_HEADER*>(view);
+				const auto ntHeader = util::adjust_pointer<::IMAGE_NT_HEADERS64>(dosHeader, dosHeader->e_lfanew);
+				const auto imageSize = std::min<std::size_t>(ntHeader->OptionalHeader.SizeOfImage, a_module.size());
+				const auto delta = a_module.address() - ntHeader->OptionalHeader.ImageBase;
+				const auto& relocDir = ntHeader->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_BASERELOC];
+
+				const std::span sections(IMAGE_FIRST_SECTION(ntHeader), ntHeader->FileHeader.NumberOfSections);
+				std::vector<std::byte> expected;
+				std::vector<Range> ranges(MAX_PATCHES);
+				for (const auto& section : sections) {
+					if ((section.Characteristics & IMAGE_SCN_MEM_EXECUTE) == 0 || section.VirtualAddress >= imageSize) {
+						continue;
+					}
+					const std::size_t begin = section.VirtualAddress;
+					const auto size = std::min<std::size_t>(section.Misc.VirtualSize, imageSize - begin);
+					expected.assign(view + begin, view + begin + size);
+
+					// Apply base relocations that land in this section
+					if (delta != 0 && relocDir.VirtualAddress && relocDir.VirtualAddress + static_cast<std::size_t>(relocDir.Size) <= imageSize) {
+						auto block = reinterpret_cast<const ::IMAGE_BASE_RELOCATION*>(view + relocDir.VirtualAddress);
+						const auto blocksEnd = view + relocDir.VirtualAddress + relocDir.Size;
+						while (reinterpret_cast<const std::byte*>(block) + sizeof(::IMAGE_BASE_RELOCATION) <= blocksEnd && block->SizeOfBlock >= sizeof(::IMAGE_BASE_RELOCATION)) {
+							const std::span entries(reinterpret_cast<const std::uint16_t*>(block + 1), (block->SizeOfBlock - sizeof(::IMAGE_BASE_RELOCATION)) / sizeof(std::uint16_t));
+							for (const auto entry : entries) {
+								const std::size_t rva = block->VirtualAddress + (entry & 0xFFF);
+								if ((entry >> 12) == IMAGE_REL_BASED_DIR64 && rva >= begin && rva + sizeof(std::uint64_t) <= begin + size) {
+									std::uint64_t value;
+									std::memcpy(&value, expected.data() + (rva - begin), sizeof(value));
+									value += delta;
+									std::memcpy(expected.data() + (rva - begin), &value, sizeof(value));
+								}
+							}
+							block = reinterpret_cast<const ::IMAGE_BASE_RELOCATION*>(reinterpret_cast<const std::byte*>(block) + block->SizeOfBlock);
+						}
+					}
+
+					std::size_t count = 0;
+					std::size_t differing = 0;
+					const auto live = reinterpret_cast<const std::byte*>(a_module.address()) + begin;
+					if (!safe_diff(live, expected.data(), size, ranges.data(), ranges.size(), count, differing)) {
+						logger::warn("Code patch census: {} section {} became unreadable"sv, a_module.name(), section_name(section));
+						continue;
+					}
+					if (differing * PACKED_RATIO > size) {
+						logger::info("Code patch census: {} section {} differs in {} of {} bytes, treating it as packed on disk"sv,
+							a_module.name(), section_name(section), differing, size);
+						continue;
+					}
+
+					for (std::size_t i = 0; i < count; ++i) {
+						const auto address = a_module.address() + begin + ranges[i].offset;
+						patches.push_back({ address, ranges[i].size, resolve_target(address, a_modules) });
+					}
+				}
+			} catch (...) {
+				logger::warn("Code patch census: failed while scanning {}"sv, a_module.name());
+			}
+
+			::UnmapViewOfFile(view);
+		}
+
+		void ensure_scanned() noexcept
+		{
+			std::call_once(scanned, []() noexcept {
+				try {
+					const auto modules = get_loaded_modules();
+					for (const auto& mod : modules) {
+						if (mod->kind() == Kind::Game) {
+							scan(*mod, modules);
+						}
+					}
+					std::ranges::sort(patches, {}, &CodePatch::address);
+					logger::info("Code patch census found {} patched ranges"sv, patches.size());
+				} catch (...) {
+					patches.clear();
+				}
+			});
+		}
+	}
+
+	void preload_code_patches()
+	{
+		ensure_scanned();
+	}
+
+	std::vector<const CodePatch*> get_code_patches(const void* a_address, const Module* a_module, bool a_isReturnAddress)
+	{
+		std::vector<const CodePatch*> results;
+		if (!a_module || a_module->kind() != Kind::Game) {
+			return results;
+		}
+
+		ensure_scanned();
+		const auto addr = reinterpret_cast<std::uintptr_t>(a_address);
+		const auto [begin, end] = a_module->function_bounds(a_address, a_isReturnAddress).value_or(std::make_pair(addr, addr + 1));
+
+		// Patches are disjoint and sorted, so step back once to catch one starting before the function
+		auto it = std::ranges::lower_bound(patches, begin, {}, &CodePatch::address);
+		if (it != patches.begin() && std::prev(it)->address + std::prev(it)->size > begin) {
+			--it;
+		}
+		for (; it != patches.end() && it->address < end; ++it) {
+			results.push_back(std::addressof(*it));
+		}
+		return results;
+	}
+
+	std::string describe_code_patches(const void* a_address, const Module* a_module, bool a_isReturnAddress)
+	{
+		const auto found = get_code_patches(a_address, a_module, a_isReturnAddress);
+		if (found.empty()) {
+			return {};
+		}
+
+		std::string result = "\tpatched:";
+		std::string_view sep = " "sv;
+		for (const auto patch : found) {
+			result += fmt::format("{}0x{:X}({})"sv, sep, patch->address, patch->size);
+			if (!patch->target.empty()) {
+				result += fmt::format(" -> {}"sv, patch->target);
+			}
+			sep = ", "sv;
+		}
+		return result;
+	}
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Crash/Modules/ModuleHandler.h"
+
+namespace Crash::Modules
+{
+	// A run of executable bytes that differs from the module's file on disk (after relocation)
+	struct CodePatch
+	{
+		std::uintptr_t address{ 0 };
+		std::size_t size{ 0 };
+		std::string target;  // "Plugin.dll+0001234" if the patch is a JMP/CALL that leads into another module
+	};
+
+	// Diff the game executable's code sections against its file on disk. Runs once; later calls
+	// (including the crash-time lookup) reuse the result. Intended to run on a background thread
+	// after kDataLoaded, once plugins have installed their hooks.
+	void preload_code_patches();
+
+	// Patches overlapping the function that contains a_address (per a_module's .pdata), or the
+	// patch containing a_address when the module has no function table. Binary search per call.
+	// a_isReturnAddress is false for an instruction pointer, which may be a function's entry.
+	[[nodiscard]] std::vector<const CodePatch*> get_code_patches(const void* a_address, const Module* a_module, bool a_isReturnAddress);
+
+	// "\tpatched: 0x7FF6...(5) -> Plugin.dll+0001234, ..." for frames whose function was patched, otherwise empty
+	[[nodiscard]] std::string describe_code_patches(const void* a_address, const Module* a_module, bool a_isReturnAddress);
+}
@@ -0,0 +1,228 @@
+#include "Crash/Modules/FileHashes.h"
+
+#include <unordered_map>
+#include <wincrypt.h>
+#include <xxhash.h>
+
+namespace Crash::Modules
+{
+	namespace
+	{
+		struct FileKey
+		{
+			std::uintmax_t size{ 0 };
+			std::filesystem::file_time_type mtime;
+
+			[[nodiscard]] bool operator==(const FileKey&) const = default;
+		};
+
+		// Keyed by normalized path only, so a crash-time lookup touches no file system metadata
+		std::unordered_map<std::wstring, FileHash> file_hashes;
+		std::mutex file_hashes_mutex;
+
+		[[nodiscard]] std::string get_error_message(DWORD a_error)
+		{
+			if (a_error == 0)
+				return "No error";
+
+			LPSTR messageBuffer = nullptr;
+			const auto size = FormatMessageA(
+				FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+				nullptr, a_error, MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
+				reinterpret_cast<LPSTR>(&messageBuffer), 0, nullptr);
+
+			if (size == 0) {
+				return fmt::format("Error {:#x}", a_error);
+			}
+
+			std::string message(messageBuffer, size);
+			LocalFree(messageBuffer);
+
+			// Remove trailing newlines
+			while (!message.empty() && (message.back() == '\n' || message.back() == '\r')) {
+				message.pop_back();
+			}
+
+			return fmt::format("Error {:#x}: {}", a_error, message);
+		}
+
+		[[nodiscard]] std::optional<FileKey> get_file_key(const std::filesystem::path& a_path)
+		{
+			std::error_code ec;
+			FileKey key;
+			key.size = std::filesystem::file_size(a_path, ec);
+			if (ec) {
+				return std::nullopt;
+			}
+			key.mtime = std::filesystem::last_write_time(a_path, ec);
+			if (ec) {
+				return std::nullopt;
+			}
+			return key;
+		}
+
+		[[nodiscard]] std::wstring normalize(const std::filesystem::path& a_path)
+		{
+			auto result = a_path.lexically_normal().wstring();
+			std::ranges::transform(result, result.begin(), ::towlower);
+			return result;
+		}
+
+		[[nodiscard]] std::string md5(std::span<const std::byte> a_data)
+		{
+			HCRYPTPROV hProv = 0;
+			HCRYPTHASH hHash = 0;
+
+			if (!CryptAcquireContext(&hProv, nullptr, nullptr, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT)) {
+				return fmt::format("<CryptAcquireContext failed - {}>", get_error_message(GetLastError()));
+			}
+
+			if (!CryptCreateHash(hProv, CALG_MD5, 0, 0, &hHash)) {
+				const auto error = GetLastError();
+				CryptReleaseContext(hProv, 0);
+				return fmt::format("<CryptCreateHash failed - {}>", get_error_message(error));
+			}
+
+			// CryptHashData takes a DWORD length, so feed the view in chunks
+			constexpr std::size_t CHUNK = 1u << 20;
+			for (std::size_t offset = 0; offset < a_data.size(); offset += CHUNK) {
+				const auto len = std::min(CHUNK, a_data.size() - offset);
+				if (!CryptHashData(hHash, reinterpret_cast<const BYTE*>(a_data.data() + offset), static_cast<DWORD>(len), 0)) {
+					const auto error = GetLastError();
+					CryptDestroyHash(hHash);
+					CryptReleaseContext(hProv, 0);
+					return fmt::format("<CryptHashData failed - {}>", get_error_message(error));
+				}
+			}
+
+			DWORD dwHashLen = 16;  // MD5 is always 16 bytes
+			BYTE hash[16];
+			if (!CryptGetHashParam(hHash, HP_HASHVAL, hash, &dwHashLen, 0)) {
+				const auto error = GetLastError();
+				CryptDestroyHash(hHash);
+				CryptReleaseContext(hProv, 0);
+				return fmt::format("<CryptGetHashParam failed - {}>", get_error_message(error));
+			}
+
+			CryptDestroyHash(hHash);
+			CryptReleaseContext(hProv, 0);
+
+			std::string result;
+			result.reserve(32);
+			for (const auto byte : hash) {
+				result += fmt::format("{:02x}", byte);
+			}
+			return result;
+		}
+
+		// Size and mtime are compared around the hash so a file replaced mid-read is not cached.
+		// Loaded modules can't be rewritten while mapped, so the entry stays valid afterwards.
+		[[nodiscard]] std::optional<FileHash> hash_and_cache(const std::filesystem::path& a_path)
+		{
+			const auto before = get_file_key(a_path);
+			if (!before) {
+				return std::nullopt;
+			}
+
+			auto hash = hash_file(a_path);
+			if (get_file_key(a_path) != before) {
+				return std::nullopt;
+			}
+
+			std::lock_guard lock(file_hashes_mutex);
+			file_hashes.insert_or_assign(normalize(a_path), hash);
+			return hash;
+		}
+	}
+
+	FileHash hash_file(const std::filesystem::path& a_path)
+	{
+		try {
+			const auto file = CreateFileW(a_path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+				OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			if (file == INVALID_HANDLE_VALUE) {
+				const auto error = fmt::format("<file not accessible - {}>", get_error_message(GetLastError()));
+				return { error, error };
+			}
+
+			LARGE_INTEGER size{};
+			if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+				CloseHandle(file);
+				// CreateFileMapping rejects empty files; these are the well-known empty-input digests
+				return { "2d06800538d394c2"s, "d41d8cd98f00b204e9800998ecf8427e"s };
+			}
+
+			const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			CloseHandle(file);
+			if (!mapping) {
+				const auto error = fmt::format("<CreateFileMapping failed - {}>", get_error_message(GetLastError()));
+				return { error, error };
+			}
+
+			const auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+			if (!view) {
+				const auto error = fmt::format("<MapViewOfFile failed - {}>", get_error_message(GetLastError()));
+				return { error, error };
+			}
+
+			const std::span data{ static_cast<const std::byte*>(view), static_cast<std::size_t>(size.QuadPart) };
+			FileHash result;
+			result.xxh3 = fmt::format("{:016x}", XXH3_64bits(data.data(), data.size()));
+			result.md5 = md5(data);
+			UnmapViewOfFile(view);
+			return result;
+		} catch (const std::exception& e) {
+			const auto error = fmt::format("<exception: {}>", e.what());
+			return { error, error };
+		} catch (...) {
+			return { "<unknown exception>"s, "<unknown exception>"s };
+		}
+	}
+
+	void preload_file_hashes()
+	{
+		try {
+			std::size_t count = 0;
+
+			wchar_t exePath[MAX_PATH];
+			if (GetModuleFileNameW(nullptr, exePath, MAX_PATH) && hash_and_cache(exePath)) {
+				++count;
+			}
+
+			const auto modules = get_loaded_modules();
+			for (const auto& mod : modules) {
+				if (mod->kind() != Kind::Plugin) {
+					continue;
+				}
+				try {
+					if (hash_and_cache(std::filesystem::path{ mod->path() })) {
+						++count;
+					}
+				} catch (...) {
+					// Missing fingerprints are only cosmetic
+				}
+			}
+			logger::info("Cached hashes for {} files"sv, count);
+		} catch (const std::exception& e) {
+			logger::warn("Failed to cache file hashes: {}"sv, e.what());
+		} catch (...) {
+			logger::warn("Failed to cache file hashes"sv);
+		}
+	}
+
+	std::optional<FileHash> get_cached_file_hash(const std::filesystem::path& a_path)
+	{
+		try {
+			const auto key = normalize(a_path);
+			std::lock_guard lock(file_hashes_mutex);
+			const auto it = file_hashes.find(key);
+			if (it == file_hashes.end()) {
+				return std::nullopt;
+			}
+			return it->second;
+		} catch (...) {
+			return std::nullopt;
+		}
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Crash/Modules/ModuleHandler.h"
+
+namespace Crash::Modules
+{
+	struct FileHash
+	{
+		std::string xxh3;  // fast fingerprint, 64-bit XXH3
+		std::string md5;   // kept so logs stay comparable with older reports
+	};
+
+	// Hash a file through a read-only mapping. Errors are returned in place of the digests.
+	[[nodiscard]] FileHash hash_file(const std::filesystem::path& a_path);
+
+	// Hash the executable and every loaded SKSE plugin into the cache.
+	// Intended to run on a background thread after kPostLoad.
+	void preload_file_hashes();
+
+	// Cached hash for a_path, or nullopt if it was never hashed. A lookup by path only: safe to
+	// call from the crash handler without touching the file system.
+	[[nodiscard]] std::optional<FileHash> get_cached_file_hash(const std::filesystem::path& a_path);
+}
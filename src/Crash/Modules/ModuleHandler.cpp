@@ -42,9 +42,9 @@
 #define NODEFERWINDOWPOS
 #define NOMCX
 
+#include "Crash/Disassembly.h"
 #include "Crash/PDB/PdbHandler.h"
 #include <Psapi.h>
-#include <Zydis/Zydis.h>
 
 #undef max
 #undef min
@@ -146,6 +146,14 @@ namespace Crash::Modules
 			const void* _vtable{ nullptr };
 		};
 
+		// The offset -> ID table is built from the whole Address Library database, so it is
+		// constructed once per process and shared by every module snapshot.
+		[[nodiscard]] const REL::Offset2ID& offset2id()
+		{
+			static const REL::Offset2ID table{ std::execution::par_unseq };
+			return table;
+		}
+
 		class Fallout4 final :
 			public Module
 		{
@@ -160,17 +168,20 @@ namespace Crash::Modules
 			[[nodiscard]] std::string get_frame_info(const boost::stacktrace::frame& a_frame) const override
 			{
 				const auto offset = reinterpret_cast<std::uintptr_t>(a_frame.address()) - address();
-				const auto it = std::lower_bound(
-					_offset2ID.rbegin(),
-					_offset2ID.rend(),
+				const auto& table = offset2id();
+				// Last entry whose offset is <= the frame offset
+				auto it = std::upper_bound(
+					table.begin(),
+					table.end(),
 					offset,
 					[](auto&& a_lhs, auto&& a_rhs) noexcept {
-						return a_lhs.offset >= a_rhs;
+						return a_lhs < a_rhs.offset;
 					});
 
 				auto result = super::get_frame_info(a_frame);
 				const auto assemblyStr = assembly(a_frame.address());
-				if (it != _offset2ID.rend()) {
+				if (it != table.begin()) {
+					--it;
 					result += fmt::format(
 						" -> {}+0x{:X}"sv,
 						it->id,
@@ -178,9 +189,6 @@ namespace Crash::Modules
 				}
 				return fmt::format("{}\t{}", result, assemblyStr);
 			}
-
-		private:
-			REL::Offset2ID _offset2ID;
 		};
 
 		class Factory
@@ -252,60 +260,178 @@ namespace Crash::Modules
 
 	std::string Module::assembly(const void* a_ptr) const
 	{
-		// Zydis code from https://github.com/zyantific/zydis/blob/214536a814ba20d2e33d2a907198d1a329aac45c/examples/DisassembleSimple.c#L38-L63 under MIT
-
-		ZyanUSize offset = 0;
-		ZyanU8 data[8];
-		ZyanU64 runtime_address = (ZyanU64)a_ptr;
-		memcpy(data, (const void*)runtime_address, sizeof(data));
-		std::string assembly = "";
-		ZydisDisassembledInstruction instruction;
-		if (ZYAN_SUCCESS(ZydisDisassembleIntel(
-				/* machine_mode:    */ ZYDIS_MACHINE_MODE_LONG_64,
-				/* runtime_address: */ runtime_address,
-				/* buffer:          */ data + offset,
-				/* length:          */ sizeof(data) - offset,
-				/* instruction:     */ &instruction))) {
-			assembly = std::format("{}", instruction.text);
-		}
-		return assembly;
+		return Disassembly::assembly(a_ptr);
 	}
 
 	Module::Module(std::string a_name, std::span<const std::byte> a_image, std::string a_path) :
 		_name(std::move(a_name)),
 		_image(a_image),
-		_path(std::move(a_path))
+		_path(std::move(a_path)),
+		_kind(classify(_name, _path))
+	{}
+
+	Kind Module::classify(std::string_view a_name, std::string_view a_path) noexcept
 	{
-		auto dosHeader = reinterpret_cast<const ::IMAGE_DOS_HEADER*>(_image.data());
-		auto ntHeader = util::adjust_pointer<::IMAGE_NT_HEADERS64>(dosHeader, dosHeader->e_lfanew);
-		std::span sections(
-			IMAGE_FIRST_SECTION(ntHeader),
-			ntHeader->FileHeader.NumberOfSections);
-
-		const std::array todo{
-			std::make_pair(".data"sv, std::ref(_data)),
-			std::make_pair(".rdata"sv, std::ref(_rdata)),
+		const auto ci_equal = [](std::string_view a_lhs, std::string_view a_rhs) noexcept {
+			return a_lhs.size() == a_rhs.size() &&
+			       _strnicmp(a_lhs.data(), a_rhs.data(), a_lhs.size()) == 0;
 		};
-		for (auto& [name, section] : todo) {
-			const auto it = std::find_if(
-				sections.begin(),
-				sections.end(),
-				[&](auto&& a_elem) {
-					constexpr auto size = std::extent_v<decltype(a_elem.Name)>;
-					const auto len = std::min(name.size(), size);
-					return std::memcmp(name.data(), a_elem.Name, len) == 0;
-				});
-			if (it != sections.end()) {
-				section = std::span{ it->VirtualAddress + _image.data(), it->SizeOfRawData };
+		const auto ci_starts_with = [&](std::string_view a_str, std::string_view a_prefix) noexcept {
+			return a_str.size() >= a_prefix.size() && ci_equal(a_str.substr(0, a_prefix.size()), a_prefix);
+		};
+
+		try {
+			static const auto gameName = util::module_name();
+			if (ci_equal(a_name, gameName)) {
+				return Kind::Game;
+			}
+		} catch (...) {}
+
+		constexpr std::array systemPrefixes{ "ntdll"sv, "KERNELBASE"sv, "KERNEL32"sv, "VCRUNTIME"sv, "ucrtbase"sv };
+		for (const auto prefix : systemPrefixes) {
+			if (ci_starts_with(a_name, prefix)) {
+				return Kind::System;
 			}
 		}
 
-		if (!_image.empty() &&
-			!_data.empty() &&
-			!_rdata.empty()) {
-			detail::VTable v{ ".?AVtype_info@@"sv, _image, _data, _rdata };
-			_typeInfo = static_cast<const RE::msvc::type_info*>(v.get());
+		// Paths are generic (forward slash) strings, so the plugin folder is a plain suffix of the parent directory
+		const auto slash = a_path.find_last_of('/');
+		if (slash != std::string_view::npos) {
+			const auto directory = a_path.substr(0, slash);
+			const auto pluginDir = Crash::PDB::sPluginPath;
+			if (directory.size() >= pluginDir.size() &&
+				ci_equal(directory.substr(directory.size() - pluginDir.size()), pluginDir) &&
+				(directory.size() == pluginDir.size() || directory[directory.size() - pluginDir.size() - 1] == '/')) {
+				return Kind::Plugin;
+			}
 		}
+
+		return Kind::Other;
+	}
+
+	void Module::ensure_analyzed() const noexcept
+	{
+		std::call_once(_analyzed, [this]() noexcept {
+			if (_image.empty()) {
+				return;
+			}
+
+			// Runs lazily during the crash, where a fault in the scan arrives as a C++ exception
+			// through the SEH translator; let it escape this noexcept lambda and the log is lost
+			try {
+				auto dosHeader = reinterpret_cast<const ::IMAGE_DOS_HEADER*>(_image.data());
+				auto ntHeader = util::adjust_pointer<::IMAGE_NT_HEADERS64>(dosHeader, dosHeader->e_lfanew);
+				std::span sections(
+					IMAGE_FIRST_SECTION(ntHeader),
+					ntHeader->FileHeader.NumberOfSections);
+
+				const std::array todo{
+					std::make_pair(".data"sv, std::ref(_data)),
+					std::make_pair(".rdata"sv, std::ref(_rdata)),
+				};
+				for (auto& [name, section] : todo) {
+					const auto it = std::find_if(
+						sections.begin(),
+						sections.end(),
+						[&](auto&& a_elem) {
+							constexpr auto size = std::extent_v<decltype(a_elem.Name)>;
+							const auto len = std::min(name.size(), size);
+							return std::memcmp(name.data(), a_elem.Name, len) == 0;
+						});
+					// SizeOfRawData is the file size, which can run past the mapped image
+					if (it != sections.end() && it->VirtualAddress < _image.size()) {
+						const auto size = std::min<std::size_t>(it->SizeOfRawData, _image.size() - it->VirtualAddress);
+						section.get() = _image.subspan(it->VirtualAddress, size);
+					}
+				}
+
+				if (!_data.empty() &&
+					!_rdata.empty()) {
+					detail::VTable v{ ".?AVtype_info@@"sv, _image, _data, _rdata };
+					_typeInfo = static_cast<const RE::msvc::type_info*>(v.get());
+				}
+			} catch (...) {
+				_data = {};
+				_rdata = {};
+				_typeInfo = nullptr;
+			}
+		});
+	}
+
+	void Module::ensure_function_table() const noexcept
+	{
+		std::call_once(_functionsIndexed, [this]() noexcept {
+			if (_image.empty()) {
+				return;
+			}
+
+			try {
+				const auto dosHeader = reinterpret_cast<const ::IMAGE_DOS_HEADER*>(_image.data());
+				const auto ntHeader = util::adjust_pointer<::IMAGE_NT_HEADERS64>(dosHeader, dosHeader->e_lfanew);
+				const auto& directory = ntHeader->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXCEPTION];
+				if (directory.VirtualAddress == 0 ||
+					directory.Size < sizeof(::RUNTIME_FUNCTION) ||
+					directory.VirtualAddress + static_cast<std::size_t>(directory.Size) > _image.size()) {
+					return;
+				}
+
+				const std::span functions(
+					reinterpret_cast<const ::RUNTIME_FUNCTION*>(_image.data() + directory.VirtualAddress),
+					directory.Size / sizeof(::RUNTIME_FUNCTION));
+
+				_functions.reserve(functions.size());
+				for (const auto& function : functions) {
+					if (function.BeginAddress < function.EndAddress) {
+						_functions.push_back({ function.BeginAddress, function.EndAddress });
+					}
+				}
+
+				// The PE format requires .pdata to be sorted, but don't trust a patched image
+				const auto by_begin = [](const FunctionRange& a_lhs, const FunctionRange& a_rhs) noexcept {
+					return a_lhs.begin < a_rhs.begin;
+				};
+				if (!std::is_sorted(_functions.begin(), _functions.end(), by_begin)) {
+					std::sort(_functions.begin(), _functions.end(), by_begin);
+				}
+			} catch (...) {
+				_functions.clear();
+			}
+		});
+	}
+
+	auto Module::function_bounds(const void* a_ptr, bool a_isReturnAddress) const noexcept
+		-> std::optional<std::pair<std::uintptr_t, std::uintptr_t>>
+	{
+		if (!in_range(a_ptr)) {
+			return std::nullopt;
+		}
+
+		ensure_function_table();
+		auto rva = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(a_ptr) - address());
+		if (a_isReturnAddress) {
+			if (rva == 0) {
+				return std::nullopt;
+			}
+			--rva;  // last byte of the CALL, which may also be the last byte of its function
+		}
+
+		// Last function starting at or before rva
+		const auto it = std::upper_bound(
+			_functions.begin(),
+			_functions.end(),
+			rva,
+			[](std::uint32_t a_lhs, const FunctionRange& a_rhs) noexcept {
+				return a_lhs < a_rhs.begin;
+			});
+		if (it == _functions.begin()) {
+			return std::nullopt;
+		}
+
+		const auto& function = *std::prev(it);
+		if (rva >= function.end) {
+			return std::nullopt;
+		}
+		return std::make_pair(address() + function.begin, address() + function.end);
 	}
 
 	std::string Module::get_frame_info(const boost::stacktrace::frame& a_frame) const
@@ -326,6 +452,18 @@ namespace Crash::Modules
 			offset);
 	}
 
+	void preload_offset_table()
+	{
+		try {
+			const auto& table = detail::offset2id();
+			logger::info("Address Library offset table cached ({} entries)"sv, table.size());
+		} catch (const std::exception& e) {
+			logger::warn("Failed to cache Address Library offset table: {}"sv, e.what());
+		} catch (...) {
+			logger::warn("Failed to cache Address Library offset table"sv);
+		}
+	}
+
 	auto get_loaded_modules()
 		-> std::vector<std::unique_ptr<Module>>
 	{
@@ -9,12 +9,22 @@ namespace Crash
 			class Factory;
 		}
 
+		// Coarse module category, computed once per snapshot from the module's name and path
+		enum class Kind : std::uint8_t
+		{
+			Other,
+			Game,    // The game executable
+			Plugin,  // Loaded from Data/SKSE/Plugins
+			System   // OS/CRT exception plumbing (ntdll, KERNELBASE, KERNEL32, VCRUNTIME, ucrtbase)
+		};
+
 		class Module
 		{
 		public:
 			virtual ~Module() noexcept = default;
 
 			[[nodiscard]] std::uintptr_t address() const noexcept { return reinterpret_cast<std::uintptr_t>(_image.data()); }
+			[[nodiscard]] std::size_t size() const noexcept { return _image.size(); }
 
 			[[nodiscard]] std::string frame_info(const boost::stacktrace::frame& a_frame) const;
 
@@ -29,20 +39,47 @@ namespace Crash
 
 			[[nodiscard]] bool in_data_range(const void* a_ptr) const noexcept
 			{
+				ensure_analyzed();
 				const auto ptr = reinterpret_cast<const std::byte*>(a_ptr);
 				return _data.data() <= ptr && ptr < _data.data() + _data.size();
 			}
 
 			[[nodiscard]] bool in_rdata_range(const void* a_ptr) const noexcept
 			{
+				ensure_analyzed();
 				const auto ptr = reinterpret_cast<const std::byte*>(a_ptr);
 				return _rdata.data() <= ptr && ptr < _rdata.data() + _rdata.size();
 			}
 
+			// True if the module has an exception directory (.pdata) describing its function bodies
+			[[nodiscard]] bool has_function_table() const noexcept
+			{
+				ensure_function_table();
+				return !_functions.empty();
+			}
+
+			// True if return address a_ptr belongs to a function listed in .pdata: inside its body, or
+			// just past its end (after a trailing call). Binary search, no syscalls.
+			[[nodiscard]] bool in_function(const void* a_ptr) const noexcept
+			{
+				return function_bounds(a_ptr, true).has_value();
+			}
+
+			// Absolute [begin, end) of the .pdata function containing a_ptr. An instruction pointer
+			// (the faulting RIP, a thread's current RIP) may be a function's first byte. A return
+			// address never is: it belongs to the function that made the call, so with
+			// a_isReturnAddress the byte before it is looked up instead.
+			[[nodiscard]] std::optional<std::pair<std::uintptr_t, std::uintptr_t>> function_bounds(const void* a_ptr, bool a_isReturnAddress = false) const noexcept;
+
 			[[nodiscard]] std::string_view name() const { return _name; }
 			[[nodiscard]] std::string_view path() const { return _path; }
+			[[nodiscard]] Kind kind() const noexcept { return _kind; }
 
-			[[nodiscard]] const RE::msvc::type_info* type_info() const { return _typeInfo; }
+			[[nodiscard]] const RE::msvc::type_info* type_info() const
+			{
+				ensure_analyzed();
+				return _typeInfo;
+			}
 
 		protected:
 			friend class detail::Factory;
@@ -52,16 +89,41 @@ namespace Crash
 			[[nodiscard]] virtual std::string get_frame_info(const boost::stacktrace::frame& a_frame) const;
 
 		private:
+			// Resolve sections and the type_info vtable on first use.
+			// Name-only consumers (e.g. the startup problematic module check) never pay for the scan.
+			void ensure_analyzed() const noexcept;
+
+			// Load the RUNTIME_FUNCTION begin/end RVAs from .pdata on first use
+			void ensure_function_table() const noexcept;
+
+			struct FunctionRange
+			{
+				std::uint32_t begin;
+				std::uint32_t end;
+			};
+
+			[[nodiscard]] static Kind classify(std::string_view a_name, std::string_view a_path) noexcept;
+
 			std::string _name;
 			std::span<const std::byte> _image;
-			std::span<const std::byte> _data;
-			std::span<const std::byte> _rdata;
-			const RE::msvc::type_info* _typeInfo{ nullptr };
 			std::string _path;
+			Kind _kind{ Kind::Other };
+
+			mutable std::once_flag _analyzed;
+			mutable std::span<const std::byte> _data;
+			mutable std::span<const std::byte> _rdata;
+			mutable const RE::msvc::type_info* _typeInfo{ nullptr };
+
+			mutable std::once_flag _functionsIndexed;
+			mutable std::vector<FunctionRange> _functions;
 		};
 
 		[[nodiscard]] auto get_loaded_modules()
 			-> std::vector<std::unique_ptr<Module>>;
+
+		// Build the shared Address Library offset -> ID table ahead of any crash.
+		// Safe to call from a background thread; a crash before it finishes waits on the same table.
+		void preload_offset_table();
 	}
 
 	using module_pointer = std::unique_ptr<Modules::Module>;
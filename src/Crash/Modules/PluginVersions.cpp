@@ -0,0 +1,129 @@
+#include "Crash/Modules/PluginVersions.h"
+
+#include <unordered_map>
+
+namespace Crash::Modules
+{
+	namespace
+	{
+		// Attempt to read FileVersion string from version resource
+		[[nodiscard]] std::optional<std::string> get_file_version_string(const std::filesystem::path& filename)
+		{
+			DWORD handle = 0;
+			const auto pathW = filename.wstring();
+			const auto size = GetFileVersionInfoSizeW(pathW.c_str(), &handle);
+			if (size == 0)
+				return std::nullopt;
+
+			std::vector<std::byte> data(size);
+			if (!GetFileVersionInfoW(pathW.c_str(), handle, size, data.data()))
+				return std::nullopt;
+
+			// Try StringFileInfo translation entry first
+			struct LANGANDCODEPAGE
+			{
+				WORD wLanguage;
+				WORD wCodePage;
+			};
+			LANGANDCODEPAGE* trans = nullptr;
+			UINT transLen = 0;
+			if (VerQueryValueW(data.data(), L"\\VarFileInfo\\Translation", reinterpret_cast<LPVOID*>(&trans), &transLen) && transLen >= sizeof(LANGANDCODEPAGE)) {
+				wchar_t block[64];
+				swprintf(block, std::size(block), L"\\StringFileInfo\\%04x%04x\\FileVersion", trans[0].wLanguage, trans[0].wCodePage);
+				LPWSTR value = nullptr;
+				UINT valueLen = 0;
+				if (VerQueryValueW(data.data(), block, reinterpret_cast<LPVOID*>(&value), &valueLen) && valueLen > 0) {
+					std::wstring ws(value, valueLen);
+					// trim trailing whitespace/newlines
+					while (!ws.empty() && iswspace(ws.back())) ws.pop_back();
+					return util::utf16_to_utf8(ws).value_or(std::string());
+				}
+			}
+
+			// Fallback: use fixed file info
+			VS_FIXEDFILEINFO* ffi = nullptr;
+			UINT ffiLen = 0;
+			if (VerQueryValueW(data.data(), L"\\", reinterpret_cast<LPVOID*>(&ffi), &ffiLen) && ffi) {
+				const auto major = HIWORD(ffi->dwFileVersionMS);
+				const auto minor = LOWORD(ffi->dwFileVersionMS);
+				const auto build = HIWORD(ffi->dwFileVersionLS);
+				const auto rev = LOWORD(ffi->dwFileVersionLS);
+				return fmt::format("{}.{}.{}.{}", major, minor, build, rev);
+			}
+
+			return std::nullopt;
+		}
+
+		// Keyed by image base; the name is re-checked on lookup in case a different DLL was loaded at the same address
+		std::unordered_map<std::uintptr_t, PluginInfo> plugin_versions;
+		std::mutex plugin_versions_mutex;
+	}
+
+	PluginInfo read_plugin_info(std::string_view a_name, const std::filesystem::path& a_path)
+	{
+		try {
+			return { std::string(a_name), a_path.string(), REL::GetFileVersion(a_path.wstring()), std::nullopt };
+		} catch (const std::exception&) {
+			// Fallback: try to read whatever version string we can from the file resources
+			return { std::string(a_name), a_path.string(), std::nullopt, get_file_version_string(a_path) };
+		}
+	}
+
+	void preload_plugin_versions()
+	{
+		try {
+			const auto modules = get_loaded_modules();
+			std::size_t count = 0;
+			for (const auto& mod : modules) {
+				if (mod->kind() != Kind::Plugin) {
+					continue;
+				}
+
+				try {
+					auto info = read_plugin_info(mod->name(), std::filesystem::path{ mod->path() });
+					std::lock_guard lock(plugin_versions_mutex);
+					plugin_versions.insert_or_assign(mod->address(), std::move(info));
+					++count;
+				} catch (...) {
+					// Leave it to the crash-time fallback
+				}
+			}
+			logger::info("Cached versions for {} SKSE plugins"sv, count);
+		} catch (const std::exception& e) {
+			logger::warn("Failed to cache SKSE plugin versions: {}"sv, e.what());
+		} catch (...) {
+			logger::warn("Failed to cache SKSE plugin versions"sv);
+		}
+	}
+
+	std::vector<PluginInfo> get_plugin_versions(std::span<const module_pointer> a_modules)
+	{
+		std::vector<PluginInfo> results;
+		std::vector<const Module*> missing;
+		{
+			std::lock_guard lock(plugin_versions_mutex);
+			for (const auto& mod : a_modules) {
+				if (mod->kind() != Kind::Plugin) {
+					continue;
+				}
+				const auto it = plugin_versions.find(mod->address());
+				if (it != plugin_versions.end() && it->second.name == mod->name()) {
+					results.push_back(it->second);
+				} else {
+					missing.push_back(mod.get());
+				}
+			}
+		}
+
+		// Plugins loaded after the snapshot still need a probe
+		for (const auto mod : missing) {
+			try {
+				results.push_back(read_plugin_info(mod->name(), std::filesystem::path{ mod->path() }));
+			} catch (...) {
+				results.push_back({ std::string(mod->name()), std::string(mod->path()), std::nullopt, std::nullopt });
+			}
+		}
+
+		return results;
+	}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Crash/Modules/ModuleHandler.h"
+
+namespace Crash::Modules
+{
+	struct PluginInfo
+	{
+		std::string name;
+		std::string path;
+		std::optional<REL::Version> version;
+		std::optional<std::string> version_str;  // fallback raw/string version
+	};
+
+	// Read a plugin's version via REL::GetFileVersion, falling back to its version resource strings
+	[[nodiscard]] PluginInfo read_plugin_info(std::string_view a_name, const std::filesystem::path& a_path);
+
+	// Snapshot every loaded SKSE plugin and its version so crash logs don't touch the filesystem.
+	// Intended to run on a background thread after kPostLoad.
+	void preload_plugin_versions();
+
+	// Versions for the Plugin-kind modules in a_modules. Entries come from the startup snapshot;
+	// only plugins loaded after it (or while it was still running) are read from disk.
+	[[nodiscard]] std::vector<PluginInfo> get_plugin_versions(std::span<const module_pointer> a_modules);
+}
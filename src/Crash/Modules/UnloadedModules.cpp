@@ -0,0 +1,254 @@
+#include "Crash/Modules/UnloadedModules.h"
+
+#include <forward_list>
+#include <winternl.h>
+
+namespace Crash::Modules
+{
+	namespace
+	{
+		// ntdll loader notification types (not in the SDK headers)
+		constexpr ::ULONG LDR_DLL_NOTIFICATION_REASON_UNLOADED = 2;
+
+		struct LDR_DLL_UNLOADED_NOTIFICATION_DATA
+		{
+			::ULONG Flags;
+			const ::UNICODE_STRING* FullDllName;
+			const ::UNICODE_STRING* BaseDllName;
+			void* DllBase;
+			::ULONG SizeOfImage;
+		};
+
+		using LdrDllNotification = void(NTAPI*)(::ULONG, const LDR_DLL_UNLOADED_NOTIFICATION_DATA*, void*);
+		using LdrRegisterDllNotification_t = ::NTSTATUS(NTAPI*)(::ULONG, LdrDllNotification, void*, void**);
+		using RtlGetUnloadEventTraceEx_t = void(NTAPI*)(::ULONG**, ::ULONG**, void**);
+
+		// Layout of RTL_UNLOAD_EVENT_TRACE up to the image name; entries are strided by the reported element size
+		struct UnloadEventTrace
+		{
+			void* BaseAddress;
+			::SIZE_T SizeOfImage;
+			::ULONG Sequence;
+			::ULONG TimeDateStamp;
+			::ULONG CheckSum;
+			::WCHAR ImageName[32];
+		};
+
+		// Fixed ring written from the loader callback, which runs under the loader lock and must not allocate
+		struct UnloadSlot
+		{
+			std::uintptr_t base;
+			std::size_t size;
+			::FILETIME time;
+			wchar_t name[64];
+		};
+
+		constexpr std::size_t MAX_TRACKED = 64;
+		std::array<UnloadSlot, MAX_TRACKED> tracked{};
+		std::atomic<std::uint32_t> trackedCount{ 0 };
+		void* notificationCookie{ nullptr };
+
+		// A crash log and a hotkey thread dump can snapshot at the same time, and lookups run on
+		// many threads. Published snapshots are immutable and never freed, so a span or pointer a
+		// reader got from an older one stays valid after a newer one replaces it. Each is a few KB
+		// at most and one is made per crash log or thread dump.
+		std::mutex snapshots_lock;  // serializes publishers
+		std::forward_list<std::vector<UnloadedModule>> snapshots;
+		std::atomic<const std::vector<UnloadedModule>*> snapshot{ nullptr };
+
+		[[nodiscard]] std::span<const UnloadedModule> current_snapshot() noexcept
+		{
+			const auto published = snapshot.load(std::memory_order_acquire);
+			return published ? std::span<const UnloadedModule>{ *published } : std::span<const UnloadedModule>{};
+		}
+
+		void publish(std::vector<UnloadedModule>&& a_index)
+		{
+			std::lock_guard lock{ snapshots_lock };
+			snapshots.push_front(std::move(a_index));
+			snapshot.store(std::addressof(snapshots.front()), std::memory_order_release);
+		}
+
+		// Copy the ring the loader callback writes into a_out, oldest first, and return how many
+		// entries were copied. A slot can be overwritten while it is being copied, so the count is
+		// re-read afterwards and any slot a newer unload may have reused is dropped (a seqlock
+		// check, with the count as the sequence).
+		[[nodiscard]] std::size_t copy_tracked(std::array<UnloadSlot, MAX_TRACKED>& a_out) noexcept
+		{
+			const std::size_t count = trackedCount.load(std::memory_order_acquire);
+			const auto first = count > MAX_TRACKED ? count - MAX_TRACKED : 0;
+			for (auto i = first; i < count; ++i) {
+				a_out[i - first] = tracked[i % MAX_TRACKED];
+			}
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const std::size_t after = trackedCount.load(std::memory_order_relaxed);
+			// The writer of unload i + MAX_TRACKED reuses slot i, and starts once the count reaches that
+			const auto stable = after >= MAX_TRACKED ? after - MAX_TRACKED + 1 : 0;
+			const auto drop = std::min(count, std::max(first, stable)) - first;
+			std::move(a_out.begin() + drop, a_out.begin() + (count - first), a_out.begin());
+			return count - first - drop;
+		}
+
+		void NTAPI on_dll_notification(::ULONG a_reason, const LDR_DLL_UNLOADED_NOTIFICATION_DATA* a_data, void*)
+		{
+			if (a_reason != LDR_DLL_NOTIFICATION_REASON_UNLOADED || !a_data) {
+				return;
+			}
+
+			// Notifications are serialized by the loader lock, so a plain slot claim is enough
+			const auto index = trackedCount.load(std::memory_order_relaxed);
+			auto& slot = tracked[index % MAX_TRACKED];
+			slot.base = reinterpret_cast<std::uintptr_t>(a_data->DllBase);
+			slot.size = a_data->SizeOfImage;
+			::GetSystemTimeAsFileTime(&slot.time);
+			slot.name[0] = L'\0';
+			if (a_data->BaseDllName && a_data->BaseDllName->Buffer) {
+				const auto len = std::min<std::size_t>(a_data->BaseDllName->Length / sizeof(wchar_t), std::size(slot.name) - 1);
+				std::copy_n(a_data->BaseDllName->Buffer, len, slot.name);
+				slot.name[len] = L'\0';
+			}
+			trackedCount.store(index + 1, std::memory_order_release);
+		}
+
+		// Copy the loader's unload trace into a_out. SEH-guarded because the trace lives in ntdll's
+		// private data; kept free of unwindable objects (MSVC C2712).
+		std::size_t safe_copy_unload_trace(UnloadEventTrace* a_out, std::size_t a_max) noexcept
+		{
+			const auto ntdll = ::GetModuleHandleW(L"ntdll.dll");
+			const auto getTrace = ntdll ?
+			                          reinterpret_cast<RtlGetUnloadEventTraceEx_t>(::GetProcAddress(ntdll, "RtlGetUnloadEventTraceEx")) :
+			                          nullptr;
+			if (!getTrace) {
+				return 0;
+			}
+
+			std::size_t count = 0;
+			__try {
+				::ULONG* elementSize = nullptr;
+				::ULONG* elementCount = nullptr;
+				void* traceAddress = nullptr;
+				getTrace(&elementSize, &elementCount, &traceAddress);
+				if (!elementSize || !elementCount || !traceAddress) {
+					return 0;
+				}
+
+				// traceAddress is the ntdll variable holding the trace array pointer
+				const auto trace = *static_cast<const std::byte* const*>(traceAddress);
+				const auto stride = *elementSize;
+				if (!trace || stride < sizeof(UnloadEventTrace)) {
+					return 0;
+				}
+
+				for (std::size_t i = 0; i < *elementCount && count < a_max; ++i) {
+					const auto entry = reinterpret_cast<const UnloadEventTrace*>(trace + i * stride);
+					if (entry->BaseAddress) {
+						a_out[count++] = *entry;
+					}
+				}
+			} __except (EXCEPTION_EXECUTE_HANDLER) {
+			}
+			return count;
+		}
+
+		[[nodiscard]] std::string narrow(const wchar_t* a_name, std::size_t a_max)
+		{
+			const std::wstring_view name{ a_name, ::wcsnlen(a_name, a_max) };
+			return util::utf16_to_utf8(name).value_or(std::string());
+		}
+	}
+
+	void install_unload_tracking() noexcept
+	{
+		const auto ntdll = ::GetModuleHandleW(L"ntdll.dll");
+		const auto registerNotification = ntdll ?
+		                                      reinterpret_cast<LdrRegisterDllNotification_t>(::GetProcAddress(ntdll, "LdrRegisterDllNotification")) :
+		                                      nullptr;
+		if (!registerNotification || registerNotification(0, &on_dll_notification, nullptr, &notificationCookie) < 0) {
+			logger::warn("Failed to register for DLL unload notifications; unloaded modules will come from the loader trace only"sv);
+		}
+	}
+
+	void snapshot_unloaded_modules(std::span<const module_pointer> a_loaded) noexcept
+	{
+		try {
+			std::vector<UnloadedModule> entries;
+
+			// Loader trace first (oldest information, no timestamps)
+			std::array<UnloadEventTrace, 64> trace;
+			const auto traceCount = safe_copy_unload_trace(trace.data(), trace.size());
+			entries.reserve(traceCount + MAX_TRACKED);
+			for (std::size_t i = 0; i < traceCount; ++i) {
+				entries.push_back({ narrow(trace[i].ImageName, std::size(trace[i].ImageName)),
+					reinterpret_cast<std::uintptr_t>(trace[i].BaseAddress), trace[i].SizeOfImage, std::nullopt });
+			}
+
+			// Then our own notifications, oldest to newest, so later unloads of the same range win below
+			std::array<UnloadSlot, MAX_TRACKED> slots;
+			const auto count = copy_tracked(slots);
+			for (std::size_t i = 0; i < count; ++i) {
+				const auto& slot = slots[i];
+				const auto time = std::bit_cast<std::uint64_t>(slot.time);
+				// FILETIME is 100ns ticks since 1601; shift to the Unix epoch
+				constexpr std::uint64_t EPOCH_DIFFERENCE = 116444736000000000ull;
+				const auto since_epoch = std::chrono::duration_cast<std::chrono::system_clock::duration>(
+					std::chrono::duration<std::int64_t, std::ratio<1, 10'000'000>>(time - EPOCH_DIFFERENCE));
+				entries.push_back({ narrow(slot.name, std::size(slot.name)), slot.base, slot.size,
+					std::chrono::system_clock::time_point{ since_epoch } });
+			}
+
+			// Drop ranges a currently loaded module has reused
+			std::erase_if(entries, [&](const UnloadedModule& a_entry) {
+				return a_entry.size == 0 || std::ranges::any_of(a_loaded, [&](const module_pointer& a_mod) {
+					return a_mod->address() < a_entry.base + a_entry.size && a_entry.base < a_mod->address() + a_mod->size();
+				});
+			});
+
+			// Sort by base, keeping the most recent record for overlapping ranges so the index is disjoint
+			std::ranges::stable_sort(entries, {}, &UnloadedModule::base);
+			std::vector<UnloadedModule> index;
+			index.reserve(entries.size());
+			for (auto& entry : entries) {
+				if (!index.empty() && entry.base < index.back().base + index.back().size) {
+					// entries is stable-sorted, so on equal bases the later (newer) record follows
+					if (entry.base == index.back().base) {
+						index.back() = std::move(entry);
+					}
+					continue;
+				}
+				index.push_back(std::move(entry));
+			}
+
+			publish(std::move(index));
+		} catch (...) {
+			snapshot.store(nullptr, std::memory_order_release);
+		}
+	}
+
+	std::span<const UnloadedModule> get_unloaded_modules() noexcept
+	{
+		return current_snapshot();
+	}
+
+	const UnloadedModule* get_unloaded_module(const void* a_ptr) noexcept
+	{
+		const auto addr = reinterpret_cast<std::uintptr_t>(a_ptr);
+		const auto modules = current_snapshot();
+		auto it = std::upper_bound(modules.begin(), modules.end(), addr,
+			[](std::uintptr_t a_lhs, const UnloadedModule& a_rhs) noexcept { return a_lhs < a_rhs.base; });
+		if (it == modules.begin()) {
+			return nullptr;
+		}
+		--it;
+		return it->in_range(addr) ? std::addressof(*it) : nullptr;
+	}
+
+	std::string describe_unloaded(const void* a_ptr)
+	{
+		const auto mod = get_unloaded_module(a_ptr);
+		if (!mod) {
+			return {};
+		}
+		return fmt::format("<unloaded {}+{:07X}>"sv, mod->name, reinterpret_cast<std::uintptr_t>(a_ptr) - mod->base);
+	}
+}
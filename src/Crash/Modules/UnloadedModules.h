@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Crash/Modules/ModuleHandler.h"
+
+namespace Crash::Modules
+{
+	// A DLL that was mapped into the process and has since been unloaded
+	struct UnloadedModule
+	{
+		std::string name;
+		std::uintptr_t base{ 0 };
+		std::size_t size{ 0 };
+		std::optional<std::chrono::system_clock::time_point> unloadedAt;  // unknown for unloads only seen in the loader trace
+
+		[[nodiscard]] bool in_range(std::uintptr_t a_addr) const noexcept { return base <= a_addr && a_addr < base + size; }
+	};
+
+	// Register for loader unload notifications so unload times are known. Call once at install.
+	void install_unload_tracking() noexcept;
+
+	// Rebuild the unloaded-module interval index from our notifications and the loader's unload trace.
+	// Ranges now reused by a loaded module in a_loaded are dropped. Call once per crash log/thread dump,
+	// before any lookups. Lookups are lock-free and safe from parallel analysis, and may race a newer
+	// snapshot (a thread dump during a crash): what they return stays valid.
+	void snapshot_unloaded_modules(std::span<const module_pointer> a_loaded) noexcept;
+
+	// The last snapshot, sorted by base address
+	[[nodiscard]] std::span<const UnloadedModule> get_unloaded_modules() noexcept;
+
+	// Binary search of the last snapshot; nullptr if a_ptr is not inside a freed module range
+	[[nodiscard]] const UnloadedModule* get_unloaded_module(const void* a_ptr) noexcept;
+
+	// "<unloaded Name.dll+0001234>" for addresses inside a freed module range, otherwise empty
+	[[nodiscard]] std::string describe_unloaded(const void* a_ptr);
+}
@@ -0,0 +1,156 @@
+#include "Crash/SafeMemory.h"
+
+#include <Windows.h>
+#include <shared_mutex>
+
+namespace Crash::SafeMemory
+{
+	namespace
+	{
+		struct Region
+		{
+			std::uintptr_t end;
+			bool readable;
+		};
+
+		std::map<std::uintptr_t, Region> regions;  // keyed by region start; disjoint
+		std::shared_mutex regions_mutex;
+
+		std::atomic<std::size_t> reads{ 0 };
+		std::atomic<std::size_t> rejected{ 0 };
+		std::atomic<std::size_t> faulted{ 0 };
+		std::atomic<std::size_t> queries{ 0 };
+
+		[[nodiscard]] bool readable_protection(const ::MEMORY_BASIC_INFORMATION& a_mbi) noexcept
+		{
+			if (a_mbi.State != MEM_COMMIT || (a_mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS)) != 0) {
+				return false;
+			}
+			return (a_mbi.Protect & (PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY |
+										PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY)) != 0;
+		}
+
+		// Region containing a_address, querying and caching it on a miss
+		[[nodiscard]] std::optional<std::pair<std::uintptr_t, Region>> lookup(std::uintptr_t a_address) noexcept
+		{
+			try {
+				{
+					std::shared_lock lock(regions_mutex);
+					auto it = regions.upper_bound(a_address);
+					if (it != regions.begin() && a_address < std::prev(it)->second.end) {
+						return *std::prev(it);
+					}
+				}
+
+				::MEMORY_BASIC_INFORMATION mbi{};
+				queries.fetch_add(1, std::memory_order_relaxed);
+				if (!::VirtualQuery(reinterpret_cast<const void*>(a_address), &mbi, sizeof(mbi))) {
+					return std::nullopt;
+				}
+				const auto begin = reinterpret_cast<std::uintptr_t>(mbi.BaseAddress);
+				const Region region{ begin + mbi.RegionSize, readable_protection(mbi) };
+
+				std::unique_lock lock(regions_mutex);
+				regions.insert_or_assign(begin, region);
+				return std::make_pair(begin, region);
+			} catch (...) {
+				return std::nullopt;
+			}
+		}
+
+		// Kept free of objects that require unwinding so it can use __try/__except (MSVC C2712)
+		bool safe_copy(const void* a_src, void* a_dst, std::size_t a_size) noexcept
+		{
+			__try {
+				std::memcpy(a_dst, a_src, a_size);
+				return true;
+			} __except (EXCEPTION_EXECUTE_HANDLER) {
+				return false;
+			}
+		}
+
+		// Length of the readable prefix of [a_address, a_address + a_size)
+		[[nodiscard]] std::size_t readable_prefix(std::uintptr_t a_address, std::size_t a_size) noexcept
+		{
+			if (a_address < MIN_ADDRESS || a_address > MAX_ADDRESS) {
+				return 0;
+			}
+
+			const auto end = a_address + std::min<std::size_t>(a_size, MAX_ADDRESS + 1 - a_address);
+			auto cursor = a_address;
+			while (cursor < end) {
+				const auto region = lookup(cursor);
+				if (!region || !region->second.readable) {
+					break;
+				}
+				cursor = std::min(end, region->second.end);
+			}
+			return cursor - a_address;
+		}
+	}
+
+	bool is_readable(const void* a_address, std::size_t a_size) noexcept
+	{
+		reads.fetch_add(1, std::memory_order_relaxed);
+		const auto ok = readable_prefix(reinterpret_cast<std::uintptr_t>(a_address), a_size) == a_size;
+		if (!ok) {
+			rejected.fetch_add(1, std::memory_order_relaxed);
+		}
+		return ok;
+	}
+
+	std::size_t read_bytes(const void* a_address, void* a_out, std::size_t a_size) noexcept
+	{
+		reads.fetch_add(1, std::memory_order_relaxed);
+		const auto length = readable_prefix(reinterpret_cast<std::uintptr_t>(a_address), a_size);
+		if (length < a_size) {
+			rejected.fetch_add(1, std::memory_order_relaxed);
+		}
+		if (length == 0) {
+			return 0;
+		}
+
+		if (!safe_copy(a_address, a_out, length)) {
+			// The page changed under us (freed/decommitted by another thread); drop it from the map
+			faulted.fetch_add(1, std::memory_order_relaxed);
+			try {
+				std::unique_lock lock(regions_mutex);
+				const auto address = reinterpret_cast<std::uintptr_t>(a_address);
+				auto it = regions.upper_bound(address + length - 1);
+				while (it != regions.begin()) {
+					--it;
+					if (it->second.end <= address) {
+						break;
+					}
+					it = regions.erase(it);
+				}
+			} catch (...) {
+			}
+			return 0;
+		}
+		return length;
+	}
+
+	Stats stats() noexcept
+	{
+		return {
+			reads.load(std::memory_order_relaxed),
+			rejected.load(std::memory_order_relaxed),
+			faulted.load(std::memory_order_relaxed),
+			queries.load(std::memory_order_relaxed)
+		};
+	}
+
+	void reset() noexcept
+	{
+		try {
+			std::unique_lock lock(regions_mutex);
+			regions.clear();
+		} catch (...) {
+		}
+		reads = 0;
+		rejected = 0;
+		faulted = 0;
+		queries = 0;
+	}
+}
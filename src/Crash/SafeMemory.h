@@ -0,0 +1,41 @@
+#pragma once
+
+namespace Crash::SafeMemory
+{
+	// Addresses outside this range are never mapped in a 64-bit user-mode process
+	inline constexpr std::uintptr_t MIN_ADDRESS = 0x10000;
+	inline constexpr std::uintptr_t MAX_ADDRESS = 0x7FFF'FFFF'FFFF;
+
+	// True if [a_address, a_address + a_size) lies in committed, readable memory according to the
+	// region map. Misses are filled with one VirtualQuery each; both readable and unreadable regions
+	// are cached, so a burst of garbage values in the same free range costs one query.
+	[[nodiscard]] bool is_readable(const void* a_address, std::size_t a_size = 1) noexcept;
+
+	// Copy up to a_size bytes, stopping at the first byte the region map rejects or that faults.
+	// SEH is only the last resort for pages that changed since they were mapped.
+	std::size_t read_bytes(const void* a_address, void* a_out, std::size_t a_size) noexcept;
+
+	template <class T>
+		requires std::is_trivially_copyable_v<T>
+	[[nodiscard]] std::optional<T> read(const void* a_address) noexcept
+	{
+		T value;
+		if (read_bytes(a_address, std::addressof(value), sizeof(T)) != sizeof(T)) {
+			return std::nullopt;
+		}
+		return value;
+	}
+
+	struct Stats
+	{
+		std::size_t reads{ 0 };     // read_bytes/is_readable calls
+		std::size_t rejected{ 0 };  // refused by the region map: exceptions avoided
+		std::size_t faulted{ 0 };   // passed the map but still faulted (SEH last resort)
+		std::size_t queries{ 0 };   // VirtualQuery calls made to fill the map
+	};
+
+	[[nodiscard]] Stats stats() noexcept;
+
+	// Forget cached regions and counters; call once at the start of each crash log or thread dump
+	void reset() noexcept;
+}
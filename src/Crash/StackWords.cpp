@@ -0,0 +1,87 @@
+#include "Crash/StackWords.h"
+
+#include <emmintrin.h>
+
+namespace Crash::StackWords
+{
+	namespace
+	{
+		static_assert(classify(0) == None);
+		static_assert(classify(1) == FormID);
+		static_assert(classify(0x14) == FormID);
+		static_assert(classify(0x7FF) == FormID);
+		static_assert(classify(0x800) == FormID);
+		static_assert(classify(0xFFFF) == FormID);
+		static_assert(classify(0x10000) == (FormID | Pointer | Aligned));
+		static_assert(classify(0x0001'0003) == (FormID | Pointer));
+		static_assert(classify(0xFFFF'FFFF) == (FormID | Pointer));
+		static_assert(classify(0x1'0000'0000) == (Pointer | Aligned));
+		static_assert(classify(0x7FF6'1234'5679) == Pointer);
+		static_assert(classify(0x7FFF'FFFF'FFF8) == (Pointer | Aligned));
+		static_assert(classify(0x8000'0000'0000) == None);
+		static_assert(classify(0xFFFF'F800'0000'0000) == None);  // kernel
+		static_assert(classify(0xFFFF'FFFF'FFFF'FFFF) == None);  // -1
+
+		// Unsigned 32-bit compares via the sign-flip trick; SSE2 only has signed compares
+		[[nodiscard]] inline __m128i flip(__m128i a_value) noexcept
+		{
+			return _mm_xor_si128(a_value, _mm_set1_epi32(static_cast<int>(0x8000'0000u)));
+		}
+	}
+
+	void prefilter(std::span<const std::size_t> a_words, std::vector<Candidate>& a_out)
+	{
+		static_assert(sizeof(std::size_t) == sizeof(std::uint64_t));
+		const auto data = a_words.data();
+		const auto size = a_words.size();
+		std::size_t i = 0;
+
+		// Worst case every word survives; write through a cursor and trim once at the end
+		const auto base = a_out.size();
+		a_out.resize(base + size);
+		auto out = a_out.data() + base;
+
+		// Four qwords per step, split into high and low dwords so every test is a 32-bit lane op
+		const auto zero = _mm_setzero_si128();
+		const auto formFloor = flip(_mm_set1_epi32(static_cast<int>(MIN_FORM_ID - 1)));
+		const auto pointerFloor = flip(_mm_set1_epi32(static_cast<int>(MIN_POINTER - 1)));
+		const auto pointerHighCeiling = flip(_mm_set1_epi32(static_cast<int>(MAX_POINTER >> 32) + 1));
+		const auto alignMask = _mm_set1_epi32(7);
+		for (; i + 4 <= size; i += 4) {
+			const auto a = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+			const auto b = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 2)));
+			const auto lo = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+			const auto hi = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+
+			const auto hiZero = _mm_cmpeq_epi32(hi, zero);
+			const auto formID = _mm_and_si128(hiZero, _mm_cmpgt_epi32(flip(lo), formFloor));
+			const auto pointer = _mm_and_si128(
+				_mm_cmplt_epi32(flip(hi), pointerHighCeiling),
+				_mm_or_si128(_mm_andnot_si128(hiZero, _mm_set1_epi32(-1)), _mm_cmpgt_epi32(flip(lo), pointerFloor)));
+			const auto aligned = _mm_and_si128(pointer, _mm_cmpeq_epi32(_mm_and_si128(lo, alignMask), zero));
+
+			const auto kinds = _mm_or_si128(
+				_mm_or_si128(_mm_and_si128(formID, _mm_set1_epi32(FormID)), _mm_and_si128(pointer, _mm_set1_epi32(Pointer))),
+				_mm_and_si128(aligned, _mm_set1_epi32(Aligned)));
+			const auto keep = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(kinds, zero))) ^ 0xF;
+			if (keep == 0) {
+				continue;
+			}
+
+			alignas(16) std::uint32_t lanes[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(lanes), kinds);
+			for (std::uint32_t lane = 0; lane < 4; ++lane) {
+				*out = { static_cast<std::uint32_t>(i + lane), static_cast<std::uint8_t>(lanes[lane]) };
+				out += (keep >> lane) & 1;
+			}
+		}
+
+		for (; i < size; ++i) {
+			const auto kind = classify(data[i]);
+			*out = { static_cast<std::uint32_t>(i), kind };
+			out += kind != None;
+		}
+
+		a_out.resize(static_cast<std::size_t>(out - a_out.data()));
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Crash::StackWords
+{
+	// What a raw stack/register qword could plausibly be. A value may be both a FormID and a pointer.
+	enum Kind : std::uint8_t
+	{
+		None = 0,
+		FormID = 1 << 0,   // nonzero and fits in 32 bits
+		Pointer = 1 << 1,  // canonical user-mode address above the never-mapped first 64 KB
+		Aligned = 1 << 2,  // pointer that is 8-byte aligned (object/vtable candidates)
+	};
+
+	// Only 0 is never a form; hardcoded engine forms such as 0x7 and 0x14 (the player) still need the lookup
+	inline constexpr std::uint64_t MIN_FORM_ID = 1;
+	// Windows never maps the first 64 KB of the address space
+	inline constexpr std::uint64_t MIN_POINTER = 0x10000;
+	inline constexpr std::uint64_t MAX_POINTER = 0x7FFF'FFFF'FFFF;
+
+	// Scalar reference for the vectorized kernel
+	[[nodiscard]] constexpr std::uint8_t classify(std::uint64_t a_value) noexcept
+	{
+		std::uint8_t kind = None;
+		if (a_value >= MIN_FORM_ID && a_value <= 0xFFFF'FFFF) {
+			kind |= FormID;
+		}
+		if (a_value >= MIN_POINTER && a_value <= MAX_POINTER) {
+			kind |= Pointer;
+			if ((a_value & 7) == 0) {
+				kind |= Aligned;
+			}
+		}
+		return kind;
+	}
+
+	struct Candidate
+	{
+		std::uint32_t index;  // position in the scanned span
+		std::uint8_t kind;    // Kind bits, never None
+	};
+
+	// Classify a_words in bulk and append every word that is not None to a_out, in order.
+	// Zero, small integers and non-canonical/kernel values are dropped without per-word branches.
+	void prefilter(std::span<const std::size_t> a_words, std::vector<Candidate>& a_out);
+}
@@ -0,0 +1,81 @@
+#include "Crash/StringScan.h"
+
+#include <bit>
+#include <emmintrin.h>
+
+namespace Crash::StringScan
+{
+	namespace
+	{
+		static_assert(!is_printable('\0'));
+		static_assert(!is_printable('\r'));
+		static_assert(!is_printable('\x1F'));
+		static_assert(is_printable(' '));
+		static_assert(is_printable('~'));
+		static_assert(!is_printable('\x7F'));
+		static_assert(!is_printable('\x80'));
+		static_assert(!is_printable('\xFF'));
+		static_assert(is_printable(u'A'));
+		static_assert(!is_printable(u'\x100'));
+		static_assert(!is_printable(u'\xFF41'));
+
+		// Returns a movemask with a 1 bit per byte that is part of a rejected character. Bytes
+		// >= 0x80 are negative in the signed compares, so they fail the upper bound test too.
+		[[nodiscard]] inline int rejected_bytes(__m128i a_chunk) noexcept
+		{
+			const auto inRange = _mm_and_si128(
+				_mm_cmpgt_epi8(a_chunk, _mm_set1_epi8(0x1F)),
+				_mm_cmplt_epi8(a_chunk, _mm_set1_epi8(0x7F)));
+			const auto accepted = _mm_or_si128(inRange,
+				_mm_or_si128(_mm_cmpeq_epi8(a_chunk, _mm_set1_epi8('\t')), _mm_cmpeq_epi8(a_chunk, _mm_set1_epi8('\n'))));
+			return _mm_movemask_epi8(accepted) ^ 0xFFFF;
+		}
+
+		[[nodiscard]] inline int rejected_units(__m128i a_chunk) noexcept
+		{
+			const auto inRange = _mm_and_si128(
+				_mm_cmpgt_epi16(a_chunk, _mm_set1_epi16(0x1F)),
+				_mm_cmplt_epi16(a_chunk, _mm_set1_epi16(0x7F)));
+			const auto accepted = _mm_or_si128(inRange,
+				_mm_or_si128(_mm_cmpeq_epi16(a_chunk, _mm_set1_epi16('\t')), _mm_cmpeq_epi16(a_chunk, _mm_set1_epi16('\n'))));
+			return _mm_movemask_epi8(accepted) ^ 0xFFFF;  // two bits per unit
+		}
+
+		template <class CharT>
+		[[nodiscard]] std::size_t scalar_prefix(std::span<const CharT> a_text, std::size_t a_from) noexcept
+		{
+			while (a_from < a_text.size() && is_printable(a_text[a_from])) {
+				++a_from;
+			}
+			return a_from;
+		}
+	}
+
+	// Callers scan buffers they own, so full 16-byte loads never leave a_text; the scalar tail
+	// covers the remainder.
+	std::size_t printable_prefix(std::span<const char> a_text) noexcept
+	{
+		const auto data = a_text.data();
+		std::size_t i = 0;
+		for (; i + 16 <= a_text.size(); i += 16) {
+			const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+			if (const auto rejected = rejected_bytes(chunk)) {
+				return i + std::countr_zero(static_cast<unsigned>(rejected));
+			}
+		}
+		return scalar_prefix(a_text, i);
+	}
+
+	std::size_t printable_prefix(std::span<const char16_t> a_text) noexcept
+	{
+		const auto data = a_text.data();
+		std::size_t i = 0;
+		for (; i + 8 <= a_text.size(); i += 8) {
+			const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+			if (const auto rejected = rejected_units(chunk)) {
+				return i + std::countr_zero(static_cast<unsigned>(rejected)) / 2;
+			}
+		}
+		return scalar_prefix(a_text, i);
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace Crash::StringScan
+{
+	// Scalar reference for the vectorized kernels: the characters accepted in a string the crash
+	// log prints. Wide strings are limited to the same ASCII subset; anything broader matches
+	// almost any pair of bytes and turns random stack data into "strings".
+	template <class CharT>
+	[[nodiscard]] constexpr bool is_printable(CharT a_ch) noexcept
+	{
+		const auto ch = static_cast<std::make_unsigned_t<CharT>>(a_ch);
+		return (0x20 <= ch && ch <= 0x7E) || ch == '\t' || ch == '\n';
+	}
+
+	// Length of the leading run of printable characters: the index of the first NUL or other
+	// non-printable character, or a_text.size() if there is none. 16 bytes are tested per step.
+	[[nodiscard]] std::size_t printable_prefix(std::span<const char> a_text) noexcept;
+	[[nodiscard]] std::size_t printable_prefix(std::span<const char16_t> a_text) noexcept;
+
+	inline constexpr std::uintptr_t PAGE_SIZE = 0x1000;
+
+	// Copy a_ptr into a_buffer one page at a time and scan each piece as it arrives, so a short
+	// string stops the copy early and the next page is only touched if the text runs into it.
+	// a_read(const void* src, void* dst, std::size_t bytes) returns how many bytes it copied
+	// before the first unreadable one. Returns the length of a printable, NUL-terminated string
+	// that fits in a_buffer.
+	template <class CharT, class Read>
+	[[nodiscard]] std::optional<std::size_t> terminated_length(const void* a_ptr, std::span<CharT> a_buffer, Read&& a_read) noexcept
+	{
+		const auto base = reinterpret_cast<std::uintptr_t>(a_ptr);
+		std::size_t count = 0;
+		while (count < a_buffer.size()) {
+			const auto at = base + count * sizeof(CharT);
+			const auto want = std::min<std::size_t>(a_buffer.size() - count, (PAGE_SIZE - (at & (PAGE_SIZE - 1))) / sizeof(CharT));
+			const auto got = a_read(reinterpret_cast<const void*>(at), a_buffer.data() + count, want * sizeof(CharT)) / sizeof(CharT);
+			const auto stop = count + printable_prefix(std::span<const CharT>{ a_buffer.data() + count, got });
+			count += got;
+			if (stop < count) {
+				return a_buffer[stop] == CharT{ 0 } ? std::make_optional(stop) : std::nullopt;
+			}
+			if (got < want) {
+				return std::nullopt;  // unreadable before the terminator
+			}
+		}
+		return std::nullopt;  // unterminated within the buffer
+	}
+
+	struct Found
+	{
+		std::size_t length;  // characters in a_narrow or a_wide, excluding the terminator
+		bool wide;           // the string is in a_wide
+	};
+
+	// Decide whether a_ptr points at a narrow or UTF-16 string, reading through a_read as
+	// terminated_length() does. Narrow strings of two or more characters win; a one-character
+	// narrow string is only kept if the bytes don't also read as a longer UTF-16 string.
+	template <class Read>
+	[[nodiscard]] std::optional<Found> find_string(const void* a_ptr, std::span<char> a_narrow, std::span<char16_t> a_wide, Read&& a_read) noexcept
+	{
+		const auto narrow = terminated_length(a_ptr, a_narrow, a_read);
+		if (narrow && *narrow > 1) {
+			return Found{ *narrow, false };
+		}
+
+		// "A\0B\0C\0" reads as the one-character string "A"; check for UTF-16 before settling
+		if ((reinterpret_cast<std::uintptr_t>(a_ptr) & 1) == 0) {
+			if (const auto wide = terminated_length(a_ptr, a_wide, a_read); wide && *wide > 1) {
+				return Found{ *wide, true };
+			}
+		}
+
+		if (narrow && *narrow == 1) {
+			return Found{ 1, false };
+		}
+		return std::nullopt;
+	}
+}
@@ -2,9 +2,12 @@
 #include "Crash/CommonHeader.h"
 
 #include "Crash/Analysis.h"
+#include "Crash/Disassembly.h"
 #include "Crash/Introspection/Introspection.h"
 #include "Crash/Modules/ModuleHandler.h"
+#include "Crash/Modules/UnloadedModules.h"
 #include "Crash/PDB/PdbHandler.h"
+#include "Crash/SafeMemory.h"
 #include "RE/C/ConsoleLog.h"
 #include "RE/S/SendHUDMessage.h"
 #include <Settings.h>
@@ -26,8 +29,13 @@ namespace Crash
 	static std::jthread g_hotkeyThread;
 
 	std::optional<ThreadData> CollectThreadData(DWORD threadId, size_t index,
-		std::span<const module_pointer> a_modules, const std::string& processName, const std::filesystem::path& pluginDir)
+		std::span<const module_pointer> a_modules)
 	{
+		// Game executable or SKSE plugin code is what makes a thread interesting for hang diagnosis
+		const auto is_game_or_plugin = [](const Modules::Module* a_mod) noexcept {
+			return a_mod->kind() == Modules::Kind::Game || a_mod->kind() == Modules::Kind::Plugin;
+		};
+
 		ThreadData data{ threadId, index, {}, 0 };
 
 		HANDLE thread = OpenThread(THREAD_GET_CONTEXT | THREAD_SUSPEND_RESUME | THREAD_QUERY_INFORMATION,
@@ -54,27 +62,23 @@ namespace Crash
 					// Check RIP first
 					const auto rip_mod = Introspection::get_module_for_pointer(reinterpret_cast<void*>(ctx.Rip), a_modules);
 					if (rip_mod && rip_mod->in_range(reinterpret_cast<void*>(ctx.Rip))) {
-						std::string ripModName(rip_mod->name().data(), rip_mod->name().size());
-						data.callstackModules.push_back(ripModName);
-						if (ripModName == processName ||
-							(ripModName.ends_with(".dll") && std::filesystem::exists(pluginDir / ripModName))) {
+						data.callstackModules.push_back(rip_mod);
+						if (is_game_or_plugin(rip_mod)) {
 							data.priority = 2;  // RIP in game module
 						}
 					}
 
-					// Walk stack from captured CONTEXT's RSP
-					const auto rsp = reinterpret_cast<const std::size_t*>(ctx.Rsp);
-					constexpr size_t MAX_STACK_SCAN = 512;  // 4KB of stack
-
-					for (size_t i = 0; i < MAX_STACK_SCAN; ++i) {
-						const auto addr = rsp[i];
-						const auto mod = Introspection::get_module_for_pointer(reinterpret_cast<void*>(addr), a_modules);
-						if (mod && mod->in_range(reinterpret_cast<void*>(addr))) {
-							std::string modName(mod->name().data(), mod->name().size());
-							if (std::find(data.callstackModules.begin(), data.callstackModules.end(), modName) == data.callstackModules.end()) {
-								data.callstackModules.push_back(modName);
-								if (data.priority < 2 && (modName == processName ||
-															 (modName.ends_with(".dll") && std::filesystem::exists(pluginDir / modName)))) {
+					// Unwind from the captured CONTEXT; the thread is suspended so the walk is stable
+					constexpr size_t MAX_FRAMES = 64;
+					const void* frames[MAX_FRAMES]{};
+					const auto frameCount = unwind_context(ctx, frames);
+
+					for (size_t i = 1; i < frameCount; ++i) {
+						const auto mod = Introspection::get_module_for_pointer(frames[i], a_modules);
+						if (mod) {
+							if (std::find(data.callstackModules.begin(), data.callstackModules.end(), mod) == data.callstackModules.end()) {
+								data.callstackModules.push_back(mod);
+								if (data.priority < 2 && is_game_or_plugin(mod)) {
 									data.priority = data.priority == 0 ? 1 : data.priority;  // Any in stack, but not overriding RIP priority
 								}
 							}
@@ -125,34 +129,45 @@ namespace Crash
 			if (GetThreadContext(thread, &ctx)) {
 				// Print registers WITH introspection (shared DRY code)
 				// This will show what objects/locks each register points to
-				print_registers_safe(a_log, ctx, a_modules);
+				// Each thread is its own analysis, so cross-references stay within the thread
+				Introspection::AnalysisContext analysis;
+				apply_introspection_limits(analysis);
+				print_registers_safe(a_log, analysis, ctx, a_modules);
 				a_log.critical(""sv);
 
 				a_log.critical("\tCALLSTACK:"sv);
 				try {
-					// Collect stack frames: RIP first, then scan stack for return addresses
+					// Collect stack frames: RIP first, then unwind (or scan the stack) for callers
 					std::vector<const void*> frames;
 					frames.reserve(65);  // RIP + up to 64 stack frames
 
 					// Add RIP (current instruction pointer)
 					frames.push_back(reinterpret_cast<const void*>(ctx.Rip));
 
-					// Walk stack from captured CONTEXT's RSP
-					// Scan stack memory for return addresses (limit scan to 4KB / 512 qwords)
-					try {
-						const auto rsp = reinterpret_cast<const std::size_t*>(ctx.Rsp);
-						constexpr size_t MAX_FRAMES = 64;
-						constexpr size_t MAX_STACK_SCAN = 512;  // 4KB of stack
-
-						for (size_t i = 0; i < MAX_STACK_SCAN && frames.size() < MAX_FRAMES + 1; ++i) {
-							const auto addr = rsp[i];
-							const auto mod = Introspection::get_module_for_pointer(reinterpret_cast<void*>(addr), a_modules);
-							if (mod && mod->in_range(reinterpret_cast<void*>(addr))) {
-								frames.push_back(reinterpret_cast<const void*>(addr));
+					constexpr size_t MAX_FRAMES = 64;
+					const void* unwound[MAX_FRAMES + 1]{};
+					const auto unwoundCount = unwind_context(ctx, unwound);
+					if (unwoundCount > 1) {
+						// Unwind from the captured CONTEXT (includes RIP as frame 0)
+						frames.assign(unwound, unwound + unwoundCount);
+					} else {
+						// No unwind data past RIP; scan stack memory for return addresses (limit scan to 4KB / 512 qwords)
+						try {
+							constexpr size_t MAX_STACK_SCAN = 512;  // 4KB of stack
+							const auto snapshot = StackSnapshot::capture(ctx, MAX_STACK_SCAN * sizeof(std::size_t));
+
+							for (const auto addr : snapshot.words()) {
+								if (frames.size() >= MAX_FRAMES + 1) {
+									break;
+								}
+								const auto mod = Introspection::get_module_for_pointer(reinterpret_cast<void*>(addr), a_modules);
+								if (is_plausible_return_address(reinterpret_cast<void*>(addr), mod)) {
+									frames.push_back(reinterpret_cast<const void*>(addr));
+								}
 							}
+						} catch (...) {
+							// Stack scan failed, continue with just RIP
 						}
-					} catch (...) {
-						// Stack scan failed, continue with just RIP
 					}
 
 					// Print detailed callstack with PDB symbols and assembly (shared DRY code)
@@ -188,15 +203,13 @@ namespace Crash
 			clean_old_files(logPath.parent_path(), "threaddump-"sv, ".dmp", debug.maxMinidumps);
 
 			log_common_header_info(*log, "THREAD DUMP (Manual Trigger)", "TIME:"sv);
+			Disassembly::reset_cache();
+			SafeMemory::reset();
 
 			// Get loaded modules
 			const auto modules = Modules::get_loaded_modules();
 			const std::span cmodules{ modules.begin(), modules.end() };
-
-			// Get process name and plugin dir for heuristics
-			std::filesystem::path exePath = REL::Module::get().filename();
-			std::string processName = exePath.string();
-			std::filesystem::path pluginDir{ Crash::PDB::sPluginPath };
+			Modules::snapshot_unloaded_modules(cmodules);
 
 			// Enumerate all threads
 			HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
@@ -233,7 +246,7 @@ namespace Crash
 					continue;
 				}
 
-				auto data = CollectThreadData(threadIds[i], i + 1, cmodules, processName, pluginDir);
+				auto data = CollectThreadData(threadIds[i], i + 1, cmodules);
 				if (data) {
 					threadDataList.push_back(*data);
 				}
@@ -19,11 +19,11 @@ namespace Crash
 	{
 		DWORD id;
 		size_t index;
-		std::vector<std::string> callstackModules;
+		std::vector<const Modules::Module*> callstackModules;
 		int priority;  // 2: RIP in game module, 1: any in stack, 0: none
 	};
 
-	std::optional<ThreadData> CollectThreadData(DWORD threadId, size_t index, std::span<const module_pointer> a_modules, const std::string& processName, const std::filesystem::path& pluginDir);
+	std::optional<ThreadData> CollectThreadData(DWORD threadId, size_t index, std::span<const module_pointer> a_modules);
 	void DumpSingleThread(spdlog::logger& a_log, const ThreadData& data, std::span<const module_pointer> a_modules);
 	void WriteAllThreadsDump();
 	void HotkeyMonitorThreadFunction();
@@ -140,6 +140,9 @@ void Settings::Debug::Load(CSimpleIniA& a_ini)
 	get_value(a_ini, logLevel, section, "Log Level", ";Log level of messages to buffer for printing: trace = 0, debug = 1, info = 2, warn = 3, err = 4, critical = 5, off = 6. Default: 0");
 	get_value(a_ini, flushLevel, section, "Flush Level", ";Log level to force messages to print from buffer. Default: 0");
 	get_value(a_ini, waitForDebugger, section, "Wait for Debugger for Crash", ";Enable if using VisualStudio to debug CrashLogger itself. Default: false\n;Set false otherwise because Crashlogger will not produce a crash until the debugger is detected.");
+	get_value(a_ini, introspectionDeadlineSeconds, section, "Introspection Deadline Seconds", ";Total time a crash log (or each thread of a thread dump) may spend identifying objects in registers and on the stack. Default: 30\n;Values not reached in time are printed as plain numbers and listed after the stack. 0 = unlimited");
+	get_value(a_ini, introspectionObjectBudgetMs, section, "Introspection Object Budget Ms", ";Time allowed for the details of a single object before its output is truncated. Default: 500\n;0 = unlimited");
+	get_value(a_ini, introspectionMaxDepth, section, "Introspection Max Depth", ";How many levels of nested objects (owner, target, parent...) to expand under an object. Default: 6\n;0 = unlimited");
 
 	std::vector<int> parsedHotkey;
 	if (!hotkeyStr.empty()) {
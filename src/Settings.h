@@ -30,6 +30,11 @@ public:
 		int maxHeapsToCheck{ 1 };
 		int maxHeapIterationsPerHeap{ 1000 };
 
+		// Introspection budgets (0 = unlimited)
+		int introspectionDeadlineSeconds{ 30 };
+		int introspectionObjectBudgetMs{ 500 };
+		int introspectionMaxDepth{ 6 };
+
 		// Thread context heuristics (label -> list of keywords)
 		std::vector<std::pair<std::string, std::vector<std::string>>> threadContextHeuristics;
 	};
@@ -1,5 +1,8 @@
 #include "Crash/CrashHandler.h"
+#include "Crash/Modules/CodePatches.h"
+#include "Crash/Modules/FileHashes.h"
 #include "Crash/Modules/ModuleHandler.h"
+#include "Crash/Modules/PluginVersions.h"
 #include "Crash/PDB/PdbHandler.h"
 #include "Crash/ProblematicModules.h"
 
@@ -180,8 +183,15 @@ namespace
 		if (!GetMessagingInterface()->RegisterListener([](MessagingInterface::Message* message) {
 				switch (message->type) {
 				// Skyrim lifecycle events.
-				case MessagingInterface::kPostLoad:      // Called after all plugins have finished running SKSEPlugin_Load.
-														 // It is now safe to do multithreaded operations, or operations against other plugins.
+				case MessagingInterface::kPostLoad:  // Called after all plugins have finished running SKSEPlugin_Load.
+													 // It is now safe to do multithreaded operations, or operations against other plugins.
+					// Build crash-time lookup tables off the main thread so crash logs don't pay for them
+					std::thread([]() {
+						Crash::Modules::preload_offset_table();
+						Crash::Modules::preload_plugin_versions();
+						Crash::Modules::preload_file_hashes();
+					}).detach();
+					break;
 				case MessagingInterface::kPostPostLoad:  // Called after all kPostLoad message handlers have run.
 				case MessagingInterface::kInputLoaded:   // Called when all game data has been found.
 					break;
@@ -196,6 +206,8 @@ namespace
 					} catch (...) {
 						logger::error("Failed to check for problematic modules during kDataLoaded");
 					}
+					// Hooks are installed by now; diff the game's code against disk off the main thread
+					std::thread([]() { Crash::Modules::preload_code_patches(); }).detach();
 					break;
 
 				// Skyrim game events.
@@ -0,0 +1,140 @@
+#include "Crash/Disassembly.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstring>
+
+using namespace Crash::Disassembly;
+
+namespace
+{
+	// a_bytes ends with the instruction under test; the last byte sits right before the return address
+	template <std::size_t N>
+	[[nodiscard]] bool follows(const std::uint8_t (&a_bytes)[N])
+	{
+		return follows_call(std::span<const std::uint8_t>(a_bytes, N));
+	}
+
+	// Simulated address space where only [begin, begin + size) is mapped. Reads stop at the first
+	// unmapped byte, like the guarded copy is_return_address() uses.
+	struct Mapping
+	{
+		std::uintptr_t begin;
+		const std::uint8_t* bytes;
+		std::size_t size;
+
+		std::size_t operator()(const void* a_src, std::uint8_t* a_dst, std::size_t a_max) const
+		{
+			const auto src = reinterpret_cast<std::uintptr_t>(a_src);
+			if (src < begin || src >= begin + size) {
+				return 0;
+			}
+			const auto count = std::min(a_max, begin + size - src);
+			std::memcpy(a_dst, bytes + (src - begin), count);
+			return count;
+		}
+	};
+
+	constexpr std::uintptr_t PAGE = 0x7FF6'0000'1000;
+}
+
+TEST_CASE("E8 rel32 precedes a return address", "[Disassembly]")
+{
+	constexpr std::uint8_t call_rel32[]{ 0x90, 0x90, 0xE8, 0x10, 0x20, 0x30, 0x40 };
+	CHECK(follows(call_rel32));
+	STATIC_REQUIRE(follows_call(std::span<const std::uint8_t>(call_rel32)));
+
+	constexpr std::uint8_t truncated[]{ 0xE8, 0x00, 0x00 };
+	CHECK_FALSE(follows(truncated));
+}
+
+TEST_CASE("FF /2 register and memory forms", "[Disassembly]")
+{
+	constexpr std::uint8_t call_reg[]{ 0x90, 0x90, 0x90, 0x90, 0x90, 0xFF, 0xD0 };      // call rax
+	constexpr std::uint8_t call_rex_reg[]{ 0x90, 0x90, 0x90, 0x90, 0x41, 0xFF, 0xD3 };  // call r11
+	constexpr std::uint8_t call_rex_mem[]{ 0x90, 0x90, 0x90, 0x90, 0x41, 0xFF, 0x10 };  // call [r8]
+	constexpr std::uint8_t call_mem[]{ 0x90, 0x90, 0x90, 0x90, 0x90, 0xFF, 0x10 };      // call [rax]
+	CHECK(follows(call_reg));
+	CHECK(follows(call_rex_reg));
+	CHECK(follows(call_rex_mem));
+	CHECK(follows(call_mem));
+
+	CHECK(indirect_call_length(0xD0, 0) == 2);
+	CHECK(indirect_call_length(0x10, 0) == 2);
+}
+
+TEST_CASE("FF /2 with SIB and displacements", "[Disassembly]")
+{
+	constexpr std::uint8_t call_sib[]{ 0x90, 0x90, 0x90, 0x90, 0xFF, 0x14, 0xC8 };         // call [rax+rcx*8]
+	constexpr std::uint8_t call_disp8[]{ 0x90, 0x90, 0x90, 0x90, 0xFF, 0x50, 0x18 };       // call [rax+18h]
+	constexpr std::uint8_t call_sib_disp8[]{ 0x90, 0x90, 0x90, 0xFF, 0x54, 0x24, 0x08 };   // call [rsp+8]
+	constexpr std::uint8_t call_disp32[]{ 0x90, 0xFF, 0x90, 0x00, 0x01, 0x00, 0x00 };      // call [rax+100h]
+	constexpr std::uint8_t call_sib_disp32[]{ 0xFF, 0x94, 0xC8, 0x00, 0x01, 0x00, 0x00 };  // call [rax+rcx*8+100h]
+	constexpr std::uint8_t call_sib_nobase[]{ 0xFF, 0x14, 0xCD, 0x00, 0x01, 0x00, 0x00 };  // call [rcx*8+100h]
+	constexpr std::uint8_t call_rip[]{ 0x90, 0xFF, 0x15, 0x00, 0x10, 0x00, 0x00 };         // call [rip+1000h]
+	CHECK(follows(call_sib));
+	CHECK(follows(call_disp8));
+	CHECK(follows(call_sib_disp8));
+	CHECK(follows(call_disp32));
+	CHECK(follows(call_sib_disp32));
+	CHECK(follows(call_sib_nobase));
+	CHECK(follows(call_rip));
+
+	CHECK(indirect_call_length(0x14, 0xC8) == 3);
+	CHECK(indirect_call_length(0x50, 0) == 3);
+	CHECK(indirect_call_length(0x54, 0x24) == 4);
+	CHECK(indirect_call_length(0x90, 0) == 6);
+	CHECK(indirect_call_length(0x94, 0xC8) == 7);
+	CHECK(indirect_call_length(0x14, 0xCD) == 7);
+	CHECK(indirect_call_length(0x15, 0) == 6);
+}
+
+TEST_CASE("Other FF group members and plain code are rejected", "[Disassembly]")
+{
+	constexpr std::uint8_t jmp_mem[]{ 0x90, 0x90, 0x90, 0x90, 0x90, 0xFF, 0x20 };   // jmp [rax]
+	constexpr std::uint8_t push_mem[]{ 0x90, 0x90, 0x90, 0x90, 0x90, 0xFF, 0x30 };  // push [rax]
+	constexpr std::uint8_t mov_imm[]{ 0x48, 0xC7, 0xC0, 0x01, 0x00, 0x00, 0x00 };   // mov rax, 1
+	constexpr std::uint8_t nops[]{ 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90 };
+	CHECK_FALSE(follows(jmp_mem));
+	CHECK_FALSE(follows(push_mem));
+	CHECK_FALSE(follows(mov_imm));
+	CHECK_FALSE(follows(nops));
+
+	CHECK(indirect_call_length(0x20, 0) == 0);  // /4
+	CHECK(indirect_call_length(0x18, 0) == 0);  // /3, far call
+}
+
+TEST_CASE("Call-site bytes are read through the guarded reader", "[Disassembly]")
+{
+	// call [rip+1000h] in the last bytes of the previous page, returning to the first byte of PAGE
+	std::array<std::uint8_t, 0x20> previous{};
+	previous.fill(0x90);
+	constexpr std::uint8_t call_rip[]{ 0xFF, 0x15, 0x00, 0x10, 0x00, 0x00 };
+	std::memcpy(previous.data() + previous.size() - sizeof(call_rip), call_rip, sizeof(call_rip));
+
+	SECTION("previous page mapped")
+	{
+		const Mapping mapping{ PAGE - previous.size(), previous.data(), previous.size() };
+		CHECK(precedes_call(PAGE, mapping));
+		CHECK_FALSE(precedes_call(PAGE - 1, mapping));
+	}
+
+	SECTION("return address at the start of a page after an unmapped one")
+	{
+		std::array<std::uint8_t, 0x20> page{};
+		const Mapping mapping{ PAGE, page.data(), page.size() };
+		CHECK_FALSE(precedes_call(PAGE, mapping));
+	}
+
+	SECTION("only part of the call is mapped")
+	{
+		const Mapping mapping{ PAGE - 3, previous.data() + previous.size() - 3, 3 };
+		CHECK_FALSE(precedes_call(PAGE, mapping));
+	}
+
+	SECTION("addresses too low to hold a call")
+	{
+		CHECK_FALSE(precedes_call(MAX_CALL_LENGTH - 1, [](const void*, std::uint8_t*, std::size_t) { return MAX_CALL_LENGTH; }));
+	}
+}
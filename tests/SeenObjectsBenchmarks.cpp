@@ -0,0 +1,51 @@
+#include "Crash/Introspection/SeenObjects.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <barrier>
+#include <thread>
+#include <vector>
+
+using namespace Crash::Introspection;
+
+namespace
+{
+	constexpr std::size_t WORKING_SET = 50'000;     // distinct addresses, as on a deep stack with many heap objects
+	constexpr std::size_t OPERATIONS = 1 << 19;     // lookups + inserts per run, split across the threads
+	constexpr std::uintptr_t HEAP = 0x1F0'0000'0000;
+
+	// Each worker walks the shared working set from its own offset, looking an address up and
+	// inserting it when unknown: the pattern analyze_data() workers produce on one stack
+	void hammer(SeenObjects& a_table, std::size_t a_threads)
+	{
+		a_table.reserve(WORKING_SET);
+		std::barrier start{ static_cast<std::ptrdiff_t>(a_threads) };
+		std::vector<std::jthread> workers;
+		for (std::size_t t = 0; t < a_threads; ++t) {
+			workers.emplace_back([&, t]() {
+				start.arrive_and_wait();
+				const auto count = OPERATIONS / a_threads;
+				for (std::size_t i = 0; i < count; ++i) {
+					const auto pos = (t * 7919 + i * 13) % WORKING_SET;
+					const auto ptr = reinterpret_cast<const void*>(HEAP + pos * 0x40);
+					const bool known = a_table.visit(ptr, [](const SeenObjectInfo* a_info) { return a_info != nullptr; });
+					if (!known) {
+						a_table.try_emplace(ptr, SeenObjectInfo{ nullptr, pos, {}, true }, [](auto&&, bool) {});
+					}
+				}
+			});
+		}
+	}
+}
+
+TEST_CASE("Seen-objects table contention", "[!benchmark][SeenObjects]")
+{
+	for (const std::size_t threads : { 1, 2, 4, 8, 16 }) {
+		BENCHMARK_ADVANCED(std::to_string(threads) + " threads")(Catch::Benchmark::Chronometer meter)
+		{
+			std::vector<SeenObjects> tables(meter.runs());
+			meter.measure([&](int a_run) { hammer(tables[a_run], threads); });
+		};
+	}
+}
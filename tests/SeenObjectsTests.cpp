@@ -0,0 +1,98 @@
+#include "Crash/Introspection/SeenObjects.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <barrier>
+#include <thread>
+#include <vector>
+
+using namespace Crash::Introspection;
+
+namespace
+{
+	[[nodiscard]] const void* address(std::uintptr_t a_value) noexcept
+	{
+		return reinterpret_cast<const void*>(a_value);
+	}
+}
+
+TEST_CASE("Concurrent inserts of one address keep exactly one entry", "[SeenObjects]")
+{
+	constexpr std::size_t THREADS = 16;
+	constexpr std::size_t ROUNDS = 200;
+
+	SeenObjects seen;
+	for (std::size_t round = 0; round < ROUNDS; ++round) {
+		const auto key = address(0x7FF6'0000'0000 + round * 0x40);
+		std::atomic<std::size_t> inserted{ 0 };
+		std::atomic<std::size_t> winner{ THREADS };
+		std::barrier start{ static_cast<std::ptrdiff_t>(THREADS) };
+
+		std::vector<std::jthread> workers;
+		for (std::size_t t = 0; t < THREADS; ++t) {
+			workers.emplace_back([&, t]() {
+				start.arrive_and_wait();
+				seen.try_emplace(key, SeenObjectInfo{ nullptr, t, "RSP+" + std::to_string(t), true }, [&](const SeenObjectInfo&, bool a_inserted) {
+					if (a_inserted) {
+						inserted.fetch_add(1);
+						winner.store(t);
+					}
+				});
+			});
+		}
+		workers.clear();
+
+		REQUIRE(inserted.load() == 1);
+		// Every later call saw the winner's entry, not its own
+		seen.visit(key, [&](const SeenObjectInfo* a_info) {
+			REQUIRE(a_info);
+			CHECK(a_info->first_seen_pos == winner.load());
+			CHECK(a_info->first_seen_label == "RSP+" + std::to_string(winner.load()));
+		});
+	}
+}
+
+TEST_CASE("Concurrent inserts of distinct addresses are all kept", "[SeenObjects]")
+{
+	constexpr std::size_t THREADS = 8;
+	constexpr std::size_t PER_THREAD = 4096;
+
+	SeenObjects seen;
+	seen.reserve(THREADS * PER_THREAD);
+	std::vector<std::jthread> workers;
+	for (std::size_t t = 0; t < THREADS; ++t) {
+		workers.emplace_back([&, t]() {
+			for (std::size_t i = 0; i < PER_THREAD; ++i) {
+				const auto pos = t * PER_THREAD + i;
+				seen.try_emplace(address(0x1'0000'0000 + pos * 8), SeenObjectInfo{ nullptr, pos, {}, false }, [](auto&&, bool) {});
+			}
+		});
+	}
+	workers.clear();
+
+	std::size_t found = 0;
+	for (std::size_t pos = 0; pos < THREADS * PER_THREAD; ++pos) {
+		seen.visit(address(0x1'0000'0000 + pos * 8), [&](const SeenObjectInfo* a_info) {
+			found += a_info && a_info->first_seen_pos == pos;
+		});
+	}
+	CHECK(found == THREADS * PER_THREAD);
+}
+
+TEST_CASE("update and clear", "[SeenObjects]")
+{
+	SeenObjects seen;
+	const auto key = address(0x2'0000'0000);
+	seen.update(key, [](SeenObjectInfo&) { FAIL("update ran for an unknown address"); });
+
+	seen.try_emplace(key, SeenObjectInfo{ nullptr, 3, "RSP+18", false }, [](auto&&, bool) {});
+	seen.update(key, [](SeenObjectInfo& a_info) { a_info.is_game_object = true; });
+	seen.visit(key, [](const SeenObjectInfo* a_info) {
+		REQUIRE(a_info);
+		CHECK(a_info->is_game_object);
+	});
+
+	seen.clear();
+	seen.visit(key, [](const SeenObjectInfo* a_info) { CHECK_FALSE(a_info); });
+	CHECK(seen.contention() == 0);
+}
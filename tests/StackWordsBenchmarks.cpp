@@ -0,0 +1,54 @@
+#include "Crash/StackWords.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+
+using namespace Crash::StackWords;
+
+TEST_CASE("Stack word prefilter", "[!benchmark][StackWords]")
+{
+	// A 512 KB stack snapshot: mostly zeros and small integers, some pointers and FormIDs
+	std::vector<std::size_t> words(64 * 1024);
+	std::mt19937_64 rng{ 0x5EED };
+	std::uniform_int_distribution<int> shape(0, 9);
+	for (auto& word : words) {
+		switch (shape(rng)) {
+		case 0:
+		case 1:
+			word = 0x7FF6'0000'0000 + (rng() & 0xFFFF'FFF8);
+			break;
+		case 2:
+			word = rng() & 0x00FF'FFFF;
+			break;
+		case 3:
+			word = rng();
+			break;
+		default:
+			word = rng() & 0xFF;
+			break;
+		}
+	}
+
+	std::vector<Candidate> out;
+	out.reserve(words.size());
+
+	BENCHMARK("scalar classify()")
+	{
+		out.clear();
+		for (std::size_t i = 0; i < words.size(); ++i) {
+			if (const auto kind = classify(words[i]); kind != None) {
+				out.push_back({ static_cast<std::uint32_t>(i), kind });
+			}
+		}
+		return out.size();
+	};
+
+	BENCHMARK("SSE2 prefilter()")
+	{
+		out.clear();
+		prefilter(words, out);
+		return out.size();
+	};
+}
@@ -0,0 +1,143 @@
+#include "Crash/StackWords.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+
+using namespace Crash::StackWords;
+
+namespace
+{
+	// What prefilter() must produce: the scalar classify() of every word, Nones dropped
+	[[nodiscard]] std::vector<Candidate> reference(std::span<const std::size_t> a_words)
+	{
+		std::vector<Candidate> result;
+		for (std::size_t i = 0; i < a_words.size(); ++i) {
+			if (const auto kind = classify(a_words[i]); kind != None) {
+				result.push_back({ static_cast<std::uint32_t>(i), kind });
+			}
+		}
+		return result;
+	}
+
+	void check_matches_scalar(std::span<const std::size_t> a_words)
+	{
+		std::vector<Candidate> vectorized;
+		prefilter(a_words, vectorized);
+		const auto expected = reference(a_words);
+
+		REQUIRE(vectorized.size() == expected.size());
+		for (std::size_t i = 0; i < expected.size(); ++i) {
+			INFO("word " << expected[i].index << " = 0x" << std::hex << a_words[expected[i].index]);
+			REQUIRE(vectorized[i].index == expected[i].index);
+			REQUIRE(vectorized[i].kind == expected[i].kind);
+		}
+	}
+
+	// Values on and around every threshold the kernel tests, in both dwords
+	const std::vector<std::size_t> boundaries{
+		0,
+		MIN_FORM_ID,
+		MIN_FORM_ID + 1,
+		0x14,
+		0x7FF,
+		0x800,
+		MIN_POINTER - 1,
+		MIN_POINTER,
+		MIN_POINTER + 1,
+		MIN_POINTER + 8,
+		0x7FFF'FFFF,
+		0x8000'0000,
+		0xFFFF'FFF8,
+		0xFFFF'FFFF,
+		0x1'0000'0000,
+		0x1'0000'0001,
+		0x7FFF'0000'0000,
+		MAX_POINTER - 7,
+		MAX_POINTER - 1,
+		MAX_POINTER,
+		MAX_POINTER + 1,
+		0x8000'0000'0008,
+		0xFFFF'8000'0000'0000,
+		0xFFFF'F800'0000'0000,
+		0xFFFF'FFFF'0000'0800,
+		0xFFFF'FFFF'FFFF'FFF8,
+		0xFFFF'FFFF'FFFF'FFFF,
+	};
+}
+
+TEST_CASE("prefilter keeps exactly the words classify() keeps", "[StackWords]")
+{
+	SECTION("threshold values")
+	{
+		check_matches_scalar(boundaries);
+	}
+
+	SECTION("threshold values at every position of a four-word step")
+	{
+		for (std::size_t shift = 1; shift < 4; ++shift) {
+			std::vector<std::size_t> words(shift, 0);
+			words.insert(words.end(), boundaries.begin(), boundaries.end());
+			check_matches_scalar(words);
+		}
+	}
+
+	SECTION("every length through the scalar tail")
+	{
+		for (std::size_t size = 0; size <= 13; ++size) {
+			check_matches_scalar(std::span{ boundaries }.first(size));
+		}
+	}
+
+	SECTION("random stacks")
+	{
+		std::mt19937_64 rng{ 0x5EED };
+		std::uniform_int_distribution<std::size_t> any;
+		std::uniform_int_distribution<std::size_t> pick(0, boundaries.size() - 1);
+		std::uniform_int_distribution<int> shape(0, 5);
+		std::uniform_int_distribution<std::size_t> length(0, 515);
+
+		for (int round = 0; round < 2000; ++round) {
+			std::vector<std::size_t> words(length(rng));
+			for (auto& word : words) {
+				switch (shape(rng)) {
+				case 0:
+					word = any(rng);
+					break;
+				case 1:
+					word = any(rng) & 0xFFFF;  // counts and flags
+					break;
+				case 2:
+					word = any(rng) & 0xFFFF'FFFF;  // FormIDs and small pointers
+					break;
+				case 3:
+					word = any(rng) & MAX_POINTER;  // user-mode pointers, any alignment
+					break;
+				case 4:
+					word = boundaries[pick(rng)];
+					break;
+				default:
+					word = boundaries[pick(rng)] + (any(rng) % 17) - 8;
+					break;
+				}
+			}
+			check_matches_scalar(words);
+		}
+	}
+}
+
+TEST_CASE("prefilter appends after existing candidates", "[StackWords]")
+{
+	std::vector<Candidate> out{ { 99, FormID } };
+	const std::vector<std::size_t> words{ 0, 0x1000, 0, 0x7FF6'0000'1000, 5 };
+	prefilter(words, out);
+
+	REQUIRE(out.size() == 4);
+	CHECK(out[0].index == 99);
+	CHECK(out[1].index == 1);
+	CHECK(out[1].kind == FormID);
+	CHECK(out[2].index == 3);
+	CHECK(out[2].kind == (Pointer | Aligned));
+	CHECK(out[3].index == 4);
+	CHECK(out[3].kind == FormID);
+}
@@ -0,0 +1,72 @@
+#include "Crash/StringScan.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace Crash::StringScan;
+
+namespace
+{
+	template <class CharT>
+	[[nodiscard]] std::size_t scalar_prefix(std::span<const CharT> a_text)
+	{
+		std::size_t i = 0;
+		while (i < a_text.size() && is_printable(a_text[i])) {
+			++i;
+		}
+		return i;
+	}
+
+	// 4096 analyze_string() buffers holding NUL-terminated strings of random length
+	template <class CharT>
+	[[nodiscard]] std::vector<std::vector<CharT>> make_buffers(std::size_t a_size)
+	{
+		std::mt19937_64 rng{ 0x5EED };
+		std::uniform_int_distribution<int> printable(0x20, 0x7E);
+		std::vector<std::vector<CharT>> buffers(4096, std::vector<CharT>(a_size));
+		for (auto& buffer : buffers) {
+			const auto length = rng() % a_size;
+			for (std::size_t i = 0; i < length; ++i) {
+				buffer[i] = static_cast<CharT>(printable(rng));
+			}
+			buffer[length] = 0;
+		}
+		return buffers;
+	}
+
+	template <class CharT, class F>
+	[[nodiscard]] std::size_t scan_all(const std::vector<std::vector<CharT>>& a_buffers, F&& a_scan)
+	{
+		std::size_t total = 0;
+		for (const auto& buffer : a_buffers) {
+			total += a_scan(std::span<const CharT>{ buffer });
+		}
+		return total;
+	}
+}
+
+TEST_CASE("String detector", "[!benchmark][StringScan]")
+{
+	const auto narrow = make_buffers<char>(1000);
+	const auto wide = make_buffers<char16_t>(500);
+
+	BENCHMARK("scalar, narrow")
+	{
+		return scan_all(narrow, scalar_prefix<char>);
+	};
+	BENCHMARK("SSE2, narrow")
+	{
+		return scan_all(narrow, [](std::span<const char> a_text) { return printable_prefix(a_text); });
+	};
+	BENCHMARK("scalar, UTF-16")
+	{
+		return scan_all(wide, scalar_prefix<char16_t>);
+	};
+	BENCHMARK("SSE2, UTF-16")
+	{
+		return scan_all(wide, [](std::span<const char16_t> a_text) { return printable_prefix(a_text); });
+	};
+}
@@ -0,0 +1,410 @@
+#include "Crash/StringScan.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#	include <Windows.h>
+#else
+#	include <sys/mman.h>
+#endif
+
+using namespace Crash::StringScan;
+using namespace std::literals;
+
+namespace
+{
+	constexpr std::size_t NARROW_MAX = 1000;  // analyze_string()'s buffer sizes
+	constexpr std::size_t WIDE_MAX = NARROW_MAX / 2;
+
+	// Simulated address space: pages starting at BASE, of which only [BASE, BASE + readable) can
+	// be read. Reads stop at the first unreadable byte, like SafeMemory::read_bytes.
+	class Memory
+	{
+	public:
+		static constexpr std::uintptr_t BASE = 0x7FF6'0001'0000;
+
+		explicit Memory(std::size_t a_pages) :
+			_bytes(a_pages * PAGE_SIZE, std::byte{ 0xCC }),
+			_readable(_bytes.size())
+		{}
+
+		void unmap_from(std::size_t a_offset) { _readable = a_offset; }
+
+		void write(std::size_t a_offset, const void* a_data, std::size_t a_size) { std::memcpy(_bytes.data() + a_offset, a_data, a_size); }
+
+		void fill(std::size_t a_offset, std::byte a_value, std::size_t a_size) { std::memset(_bytes.data() + a_offset, static_cast<int>(a_value), a_size); }
+
+		[[nodiscard]] std::size_t size() const noexcept { return _bytes.size(); }
+
+		[[nodiscard]] static const void* at(std::size_t a_offset) noexcept { return reinterpret_cast<const void*>(BASE + a_offset); }
+
+		std::size_t operator()(const void* a_src, void* a_dst, std::size_t a_size) const
+		{
+			const auto offset = reinterpret_cast<std::uintptr_t>(a_src) - BASE;
+			if (offset >= _readable) {
+				return 0;
+			}
+			const auto count = std::min(a_size, _readable - offset);
+			std::memcpy(a_dst, _bytes.data() + offset, count);
+			return count;
+		}
+
+		// One character at a time, for the scalar reference
+		template <class CharT>
+		[[nodiscard]] std::optional<CharT> read(std::size_t a_offset) const
+		{
+			CharT ch;
+			if ((*this)(at(a_offset), &ch, sizeof(CharT)) != sizeof(CharT)) {
+				return std::nullopt;
+			}
+			return ch;
+		}
+
+	private:
+		std::vector<std::byte> _bytes;
+		std::size_t _readable;
+	};
+
+	struct Result
+	{
+		std::optional<Found> found;
+		std::string text;  // narrowed copy of the detected string
+	};
+
+	[[nodiscard]] Result vectorized(const Memory& a_memory, std::size_t a_offset)
+	{
+		std::vector<char> narrow(NARROW_MAX);
+		std::vector<char16_t> wide(WIDE_MAX);
+		Result result{ find_string(Memory::at(a_offset), std::span{ narrow }, std::span{ wide }, a_memory), {} };
+		if (result.found) {
+			for (std::size_t i = 0; i < result.found->length; ++i) {
+				result.text.push_back(result.found->wide ? static_cast<char>(wide[i]) : narrow[i]);
+			}
+		}
+		return result;
+	}
+
+	// Character-at-a-time detector with the same acceptance rules, for comparison
+	template <class CharT>
+	[[nodiscard]] std::optional<std::string> scalar_terminated(const Memory& a_memory, std::size_t a_offset, std::size_t a_max)
+	{
+		std::string text;
+		for (std::size_t i = 0; i < a_max; ++i) {
+			const auto ch = a_memory.read<CharT>(a_offset + i * sizeof(CharT));
+			if (!ch) {
+				return std::nullopt;
+			}
+			if (*ch == 0) {
+				return text;
+			}
+			if (!is_printable(*ch)) {
+				return std::nullopt;
+			}
+			text.push_back(static_cast<char>(*ch));
+		}
+		return std::nullopt;
+	}
+
+	[[nodiscard]] Result scalar(const Memory& a_memory, std::size_t a_offset)
+	{
+		const auto narrow = scalar_terminated<char>(a_memory, a_offset, NARROW_MAX);
+		if (narrow && narrow->size() > 1) {
+			return { Found{ narrow->size(), false }, *narrow };
+		}
+		if ((Memory::BASE + a_offset) % 2 == 0) {
+			if (const auto wide = scalar_terminated<char16_t>(a_memory, a_offset, WIDE_MAX); wide && wide->size() > 1) {
+				return { Found{ wide->size(), true }, *wide };
+			}
+		}
+		if (narrow && narrow->size() == 1) {
+			return { Found{ 1, false }, *narrow };
+		}
+		return {};
+	}
+
+	void check_same(const Memory& a_memory, std::size_t a_offset)
+	{
+		const auto expected = scalar(a_memory, a_offset);
+		const auto actual = vectorized(a_memory, a_offset);
+		INFO("offset 0x" << std::hex << a_offset);
+		REQUIRE(actual.found.has_value() == expected.found.has_value());
+		if (expected.found) {
+			CHECK(actual.found->wide == expected.found->wide);
+			CHECK(actual.found->length == expected.found->length);
+			CHECK(actual.text == expected.text);
+		}
+	}
+
+	template <class CharT>
+	[[nodiscard]] std::size_t scalar_prefix(std::span<const CharT> a_text)
+	{
+		std::size_t i = 0;
+		while (i < a_text.size() && is_printable(a_text[i])) {
+			++i;
+		}
+		return i;
+	}
+
+	void put(Memory& a_memory, std::size_t a_offset, std::string_view a_text)
+	{
+		a_memory.write(a_offset, a_text.data(), a_text.size());
+	}
+
+	void put(Memory& a_memory, std::size_t a_offset, std::u16string_view a_text)
+	{
+		a_memory.write(a_offset, a_text.data(), a_text.size() * sizeof(char16_t));
+	}
+}
+
+TEST_CASE("Strings that end exactly at a page boundary", "[StringScan]")
+{
+	Memory memory{ 2 };
+	memory.unmap_from(PAGE_SIZE);
+
+	SECTION("narrow, terminator is the last readable byte")
+	{
+		const auto text = "Skyrim.esm\0"sv;
+		const auto offset = PAGE_SIZE - text.size();
+		put(memory, offset, text);
+		const auto result = vectorized(memory, offset);
+		REQUIRE(result.found);
+		CHECK_FALSE(result.found->wide);
+		CHECK(result.text == "Skyrim.esm");
+		check_same(memory, offset);
+	}
+
+	SECTION("UTF-16, terminator is the last readable unit")
+	{
+		const auto text = u"Skyrim.esm\0"sv;
+		const auto offset = PAGE_SIZE - text.size() * sizeof(char16_t);
+		put(memory, offset, text);
+		const auto result = vectorized(memory, offset);
+		REQUIRE(result.found);
+		CHECK(result.found->wide);
+		CHECK(result.text == "Skyrim.esm");
+		check_same(memory, offset);
+	}
+
+	SECTION("narrow text running into the unreadable page")
+	{
+		const auto text = "Skyrim.esm"sv;
+		const auto offset = PAGE_SIZE - text.size();
+		put(memory, offset, text);
+		CHECK_FALSE(vectorized(memory, offset).found);
+		check_same(memory, offset);
+	}
+
+	SECTION("UTF-16 text running into the unreadable page keeps only the one-character narrow reading")
+	{
+		const auto text = u"Skyrim.esm"sv;
+		const auto offset = PAGE_SIZE - text.size() * sizeof(char16_t);
+		put(memory, offset, text);
+		const auto result = vectorized(memory, offset);
+		REQUIRE(result.found);
+		CHECK_FALSE(result.found->wide);
+		CHECK(result.text == "S");
+		check_same(memory, offset);
+	}
+
+	SECTION("text continuing into a readable page")
+	{
+		memory.unmap_from(memory.size());
+		const auto text = "Data\\Textures\\sky.dds\0"sv;
+		const auto offset = PAGE_SIZE - 7;
+		put(memory, offset, text);
+		const auto result = vectorized(memory, offset);
+		REQUIRE(result.found);
+		CHECK(result.text == "Data\\Textures\\sky.dds");
+		check_same(memory, offset);
+	}
+}
+
+TEST_CASE("Strings that are too short", "[StringScan]")
+{
+	Memory memory{ 1 };
+
+	SECTION("empty")
+	{
+		memory.fill(0x100, std::byte{ 0 }, 4);
+		CHECK_FALSE(vectorized(memory, 0x100).found);
+		check_same(memory, 0x100);
+	}
+
+	SECTION("one narrow character is kept when it is not UTF-16")
+	{
+		put(memory, 0x100, "A\0\0\0"sv);
+		const auto result = vectorized(memory, 0x100);
+		REQUIRE(result.found);
+		CHECK_FALSE(result.found->wide);
+		CHECK(result.text == "A");
+		check_same(memory, 0x100);
+	}
+
+	SECTION("one UTF-16 character reads as a narrow one")
+	{
+		put(memory, 0x100, u"A\0\xCCCC"sv);
+		const auto result = vectorized(memory, 0x100);
+		REQUIRE(result.found);
+		CHECK_FALSE(result.found->wide);
+		CHECK(result.text == "A");
+	}
+
+	SECTION("UTF-16 is not tried at odd addresses")
+	{
+		put(memory, 0x101, u"Wide\0"sv);
+		const auto result = vectorized(memory, 0x101);
+		REQUIRE(result.found);
+		CHECK_FALSE(result.found->wide);
+		CHECK(result.text == "W");
+		check_same(memory, 0x101);
+	}
+
+	SECTION("non-printable first character")
+	{
+		put(memory, 0x100, "\x01Skyrim\0"sv);
+		CHECK_FALSE(vectorized(memory, 0x100).found);
+		check_same(memory, 0x100);
+	}
+}
+
+TEST_CASE("Strings with no terminator", "[StringScan]")
+{
+	Memory memory{ 2 };
+
+	SECTION("narrow text longer than the buffer")
+	{
+		memory.fill(0, std::byte{ 'a' }, NARROW_MAX + 64);
+		CHECK_FALSE(vectorized(memory, 0).found);
+		check_same(memory, 0);
+	}
+
+	SECTION("narrow text that fills the buffer exactly")
+	{
+		memory.fill(0, std::byte{ 'a' }, NARROW_MAX);
+		memory.fill(NARROW_MAX, std::byte{ 0 }, 2);
+		CHECK_FALSE(vectorized(memory, 0).found);
+		memory.fill(NARROW_MAX - 1, std::byte{ 0 }, 1);
+		const auto result = vectorized(memory, 0);
+		REQUIRE(result.found);
+		CHECK(result.found->length == NARROW_MAX - 1);
+		check_same(memory, 0);
+	}
+
+	SECTION("UTF-16 text longer than the buffer")
+	{
+		const std::u16string text(WIDE_MAX + 16, u'w');
+		put(memory, 0, text);
+		const auto result = vectorized(memory, 0);
+		REQUIRE(result.found);
+		CHECK_FALSE(result.found->wide);  // falls back to the narrow "w"
+		check_same(memory, 0);
+	}
+}
+
+TEST_CASE("Vector and scalar detectors agree on random memory", "[StringScan]")
+{
+	std::mt19937_64 rng{ 0x5EED };
+	std::uniform_int_distribution<int> shape(0, 7);
+	std::uniform_int_distribution<int> printable(0x20, 0x7E);
+	std::uniform_int_distribution<std::size_t> run(0, 80);
+
+	for (int round = 0; round < 200; ++round) {
+		Memory memory{ 2 };
+		std::size_t offset = 0;
+		while (offset < memory.size()) {
+			const auto length = std::min(run(rng), memory.size() - offset);
+			switch (shape(rng)) {
+			case 0:
+			case 1:
+				for (std::size_t i = 0; i < length; ++i) {
+					memory.fill(offset + i, std::byte(printable(rng)), 1);
+				}
+				break;
+			case 2:
+				// UTF-16 ASCII
+				for (std::size_t i = 0; i + 1 < length; i += 2) {
+					memory.fill(offset + i, std::byte(printable(rng)), 1);
+					memory.fill(offset + i + 1, std::byte{ 0 }, 1);
+				}
+				break;
+			case 3:
+				memory.fill(offset, std::byte{ 0 }, std::min<std::size_t>(length, 3));
+				break;
+			default:
+				for (std::size_t i = 0; i < length; ++i) {
+					memory.fill(offset + i, std::byte(rng() & 0xFF), 1);
+				}
+				break;
+			}
+			offset += std::max<std::size_t>(length, 1);
+		}
+		memory.unmap_from(std::uniform_int_distribution<std::size_t>(PAGE_SIZE / 2, memory.size())(rng));
+
+		for (std::size_t start = 0; start < memory.size(); start += 1 + rng() % 61) {
+			check_same(memory, start);
+		}
+	}
+}
+
+TEST_CASE("printable_prefix matches the scalar scan at every length", "[StringScan]")
+{
+	std::mt19937_64 rng{ 0x5EED };
+	std::uniform_int_distribution<int> printable(0x20, 0x7E);
+
+	for (std::size_t size = 0; size <= 64; ++size) {
+		for (std::size_t reject = 0; reject <= size; ++reject) {
+			std::vector<char> narrow(size);
+			std::vector<char16_t> wide(size);
+			for (std::size_t i = 0; i < size; ++i) {
+				narrow[i] = static_cast<char>(printable(rng));
+				wide[i] = static_cast<char16_t>(printable(rng));
+			}
+			if (reject < size) {
+				narrow[reject] = static_cast<char>(rng() % 2 ? 0 : 0x80 | (rng() & 0x7F));
+				wide[reject] = static_cast<char16_t>(rng() % 2 ? 0 : 0x7F + (rng() & 0xFF00));
+			}
+			CHECK(printable_prefix(std::span<const char>{ narrow }) == scalar_prefix(std::span<const char>{ narrow }));
+			CHECK(printable_prefix(std::span<const char16_t>{ wide }) == scalar_prefix(std::span<const char16_t>{ wide }));
+		}
+	}
+}
+
+TEST_CASE("printable_prefix stays inside a span that ends at a guard page", "[StringScan]")
+{
+	// Real pages this time: a load past the span would fault on the second one
+#ifdef _WIN32
+	const auto pages = static_cast<char*>(::VirtualAlloc(nullptr, 2 * PAGE_SIZE, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+	REQUIRE(pages);
+	DWORD old;
+	REQUIRE(::VirtualProtect(pages + PAGE_SIZE, PAGE_SIZE, PAGE_NOACCESS, &old));
+#else
+	const auto pages = static_cast<char*>(::mmap(nullptr, 2 * PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+	REQUIRE(pages != MAP_FAILED);
+	REQUIRE(::mprotect(pages + PAGE_SIZE, PAGE_SIZE, PROT_NONE) == 0);
+#endif
+
+	std::memset(pages, 'x', PAGE_SIZE);
+	for (std::size_t size = 0; size <= 40; ++size) {
+		const auto narrow = std::span<const char>{ pages + PAGE_SIZE - size, size };
+		CHECK(printable_prefix(narrow) == size);
+	}
+
+	const auto units = reinterpret_cast<char16_t*>(pages);
+	std::fill(units, units + PAGE_SIZE / sizeof(char16_t), u'x');
+	for (std::size_t size = 0; size <= 40; ++size) {
+		const auto wide = std::span<const char16_t>{ units + PAGE_SIZE / sizeof(char16_t) - size, size };
+		CHECK(printable_prefix(wide) == size);
+	}
+
+#ifdef _WIN32
+	::VirtualFree(pages, 0, MEM_RELEASE);
+#else
+	::munmap(pages, 2 * PAGE_SIZE);
+#endif
+}